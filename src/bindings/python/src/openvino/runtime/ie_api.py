@@ -22,7 +22,7 @@ def tensor_from_file(path: str) -> Tensor:
     return Tensor(np.fromfile(path, dtype=np.uint8))  # type: ignore
 
 
-def set_scalar_tensor(request: InferRequestBase, tensor: Tensor, key: Union[str, int, ConstOutput] = None) -> None:
+def set_request_tensor(request: InferRequestBase, tensor: Tensor, key: Union[str, int, ConstOutput] = None) -> None:
     if key is None:
         request.set_input_tensor(tensor)
     elif isinstance(key, int):
@@ -33,11 +33,23 @@ def set_scalar_tensor(request: InferRequestBase, tensor: Tensor, key: Union[str,
         raise TypeError(f"Unsupported key type: {type(key)} for Tensor under key: {key}")
 
 
+def get_request_tensor(request: InferRequestBase, key: Union[str, int, ConstOutput] = None) -> Tensor:
+    if key is None:
+        return request.get_input_tensor()
+    elif isinstance(key, int):
+        return request.get_input_tensor(key)
+    elif isinstance(key, (str, ConstOutput)):
+        return request.get_tensor(key)
+    else:
+        raise TypeError(f"Unsupported key type: {type(key)} for Tensor under key: {key}")
+
+
 @singledispatch
 def update_tensor(
     inputs: Union[np.ndarray, np.number, int, float],
     request: InferRequestBase,
     key: Union[str, int, ConstOutput] = None,
+    share_inputs: bool = False,
 ) -> None:
     raise TypeError(f"Incompatible input data of type {type(inputs)} under {key} key!")
 
@@ -47,19 +59,26 @@ def _(
     inputs: np.ndarray,
     request: InferRequestBase,
     key: Union[str, int, ConstOutput] = None,
+    share_inputs: bool = False,
 ) -> None:
     # If shape is "empty", assume this is a scalar value
     if not inputs.shape:
-        set_scalar_tensor(request, Tensor(inputs), key)
+        set_request_tensor(request, Tensor(inputs), key)
     else:
-        if key is None:
-            tensor = request.get_input_tensor()
-        elif isinstance(key, int):
-            tensor = request.get_input_tensor(key)
-        elif isinstance(key, (str, ConstOutput)):
-            tensor = request.get_tensor(key)
-        else:
-            raise TypeError(f"Unsupported key type: {type(key)} for Tensor under key: {key}")
+        tensor = get_request_tensor(request, key)
+        # Contiguous arrays of the same type are set to the request without copying.
+        if share_inputs and inputs.flags["C_CONTIGUOUS"]:
+            shared_tensor = Tensor(inputs, shared_memory=True)
+            if shared_tensor.element_type == tensor.element_type:
+                set_request_tensor(request, shared_tensor, key)
+                request._set_shared_input(shared_tensor, True)
+                return
+        # The tensor set by `share_inputs` before shares memory with the array of that call,
+        # so it is replaced by a new Tensor owned by the request instead of being overwritten.
+        if request._is_shared_input(tensor):
+            request._set_shared_input(tensor, False)
+            tensor = Tensor(tensor.element_type, inputs.shape)
+            set_request_tensor(request, tensor, key)
         # Update shape if there is a mismatch
         if tensor.shape != inputs.shape:
             tensor.shape = inputs.shape
@@ -74,19 +93,22 @@ def _(
     inputs: Union[np.number, float, int],
     request: InferRequestBase,
     key: Union[str, int, ConstOutput] = None,
+    share_inputs: bool = False,
 ) -> None:
-    set_scalar_tensor(
+    set_request_tensor(
         request,
         Tensor(np.ndarray([], type(inputs), np.array(inputs))),
         key,
     )
 
 
-def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
+def normalize_inputs(request: InferRequestBase, inputs: dict, share_inputs: bool = False) -> dict:
     """Helper function to prepare inputs for inference.
 
     It creates copy of Tensors or copy data to already allocated Tensors on device
     if the item is of type `np.ndarray`, `np.number`, `int`, `float` or has numpy __array__ attribute.
+    If `share_inputs` is set, C-contiguous `np.ndarray` items of the matching type are set
+    to the request as Tensors sharing memory with them.
     """
     # Create new temporary dictionary.
     # new_inputs will be used to transfer data to inference calls,
@@ -97,7 +119,7 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
             raise TypeError(f"Incompatible key type for input: {key}")
         # Copy numpy arrays to already allocated Tensors.
         if isinstance(value, (np.ndarray, np.number, int, float)):
-            update_tensor(value, request, key)
+            update_tensor(value, request, key, share_inputs)
         # If value is of Tensor type, put it into temporary dictionary.
         elif isinstance(value, Tensor):
             new_inputs[key] = value
@@ -113,7 +135,7 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None) -> dict:
+    def infer(self, inputs: Any = None, share_inputs: bool = False, share_outputs: bool = False) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -137,31 +159,46 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Any, optional
+        :param share_inputs: If `True`, C-contiguous `numpy.array` inputs of the same type as
+                             the model inputs are not copied, the request works on their memory.
+                             Such tensors stay set on the request after the call and keep
+                             the arrays alive. Next copying calls replace them with tensors
+                             owned by the request instead of overwriting the arrays.
+        :type share_inputs: bool, optional
+        :param share_outputs: If `True`, returned arrays share memory with output tensors
+                              of the request instead of copying it. The arrays are
+                              overwritten by the next inference of this request.
+                              Outputs of types with less than 8 bits (u1, u4, i4)
+                              can't be shared, TypeError is raised for them.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
-            return super().infer({})
+            return super().infer({}, share_outputs)
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs, share_inputs), share_outputs)
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
-            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}))
+            return super().infer(
+                normalize_inputs(self, {index: input for index, input in enumerate(inputs)}, share_inputs),
+                share_outputs,
+            )
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
-            return super().infer(inputs)
+            return super().infer(inputs, share_outputs)
         # If inputs are single numpy array or scalars, use helper function to copy them
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
-            update_tensor(inputs, self)
-            return super().infer({})
+            update_tensor(inputs, self, share_inputs=share_inputs)
+            return super().infer({}, share_outputs)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
@@ -169,6 +206,7 @@ class InferRequest(InferRequestBase):
         self,
         inputs: Any = None,
         userdata: Any = None,
+        share_inputs: bool = False,
     ) -> None:
         """Starts inference of specified input(s) in asynchronous mode.
 
@@ -196,17 +234,24 @@ class InferRequest(InferRequestBase):
         :type inputs: Any, optional
         :param userdata: Any data that will be passed inside the callback.
         :type userdata: Any
+        :param share_inputs: If `True`, C-contiguous `numpy.array` inputs of the same type as
+                             the model inputs are not copied, the request works on their memory.
+                             Such arrays must not be modified or released until the request is finished.
+        :type share_inputs: bool, optional
         """
         if inputs is None:
             super().start_async({}, userdata)
         elif isinstance(inputs, dict):
-            super().start_async(normalize_inputs(self, inputs), userdata)
+            super().start_async(normalize_inputs(self, inputs, share_inputs), userdata)
         elif isinstance(inputs, (list, tuple)):
-            super().start_async(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}), userdata)
+            super().start_async(
+                normalize_inputs(self, {index: input for index, input in enumerate(inputs)}, share_inputs),
+                userdata,
+            )
         elif isinstance(inputs, Tensor):
             super().start_async(inputs, userdata)
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
-            update_tensor(inputs, self)
+            update_tensor(inputs, self, share_inputs=share_inputs)
             return super().start_async({}, userdata)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
@@ -303,6 +348,7 @@ class AsyncInferQueue(AsyncInferQueueBase):
         self,
         inputs: Any = None,
         userdata: Any = None,
+        share_inputs: bool = False,
     ) -> None:
         """Run asynchronous inference using the next available InferRequest from the pool.
 
@@ -326,12 +372,16 @@ class AsyncInferQueue(AsyncInferQueueBase):
         :type inputs: Any, optional
         :param userdata: Any data that will be passed to a callback.
         :type userdata: Any, optional
+        :param share_inputs: If `True`, C-contiguous `numpy.array` inputs of the same type as
+                             the model inputs are not copied, the request works on their memory.
+                             Such arrays must not be modified or released until the request is finished.
+        :type share_inputs: bool, optional
         """
         if inputs is None:
             super().start_async({}, userdata)
         elif isinstance(inputs, dict):
             super().start_async(
-                normalize_inputs(self[self.get_idle_request_id()], inputs),
+                normalize_inputs(self[self.get_idle_request_id()], inputs, share_inputs),
                 userdata,
             )
         elif isinstance(inputs, (list, tuple)):
@@ -339,13 +389,14 @@ class AsyncInferQueue(AsyncInferQueueBase):
                 normalize_inputs(
                     self[self.get_idle_request_id()],
                     {index: input for index, input in enumerate(inputs)},
+                    share_inputs,
                 ),
                 userdata,
             )
         elif isinstance(inputs, Tensor):
             super().start_async(inputs, userdata)
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
-            update_tensor(inputs, self[self.get_idle_request_id()])
+            update_tensor(inputs, self[self.get_idle_request_id()], share_inputs=share_inputs)
             super().start_async({}, userdata)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self[self.get_idle_request_id()])
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -84,7 +85,22 @@ public:
             throw m_errors.front();
     }
 
+    void set_completion_queue(bool enabled) {
+        // acquire the mutex to access m_completion_queue, m_completed_handles and m_idle_handles
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completion_queue = enabled;
+        // handles which are not processed yet would never become idle in the per-request callbacks mode
+        if (!enabled) {
+            while (!m_completed_handles.empty()) {
+                m_idle_handles.push(m_completed_handles.front().first);
+                m_completed_handles.pop();
+            }
+            m_cv.notify_all();
+        }
+    }
+
     void set_default_callbacks() {
+        set_completion_queue(false);
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
 
@@ -110,7 +126,97 @@ public:
         }
     }
 
+    void set_completion_queue_callbacks() {
+        // Callbacks of this mode never touch Python objects, so runtime threads do not
+        // contend for the GIL. Finished handles are collected in m_completed_handles
+        // and handed to Python in batches by process_completed() together with the
+        // exception of the request if it failed.
+        set_completion_queue(true);
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                {
+                    // acquire the mutex to access m_completed_handles and m_idle_handles
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    // the pool could be switched to another mode while the request was running
+                    if (m_completion_queue) {
+                        m_completed_handles.emplace(handle, exception_ptr);
+                    } else {
+                        m_idle_handles.push(handle);
+                    }
+                }
+                // Notify locks in process_completed() and getIdleRequestId()
+                m_cv.notify_all();
+            });
+        }
+    }
+
+    size_t process_completed(py::function f_callback, size_t max_items, int64_t timeout) {
+        std::vector<std::pair<size_t, std::exception_ptr>> handles;
+        {
+            // release GIL while waiting for completions
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!m_completion_queue) {
+                throw ov::Exception("process_completed can be used only after set_completion_queue was called");
+            }
+            auto has_completed = [this] {
+                return !m_completed_handles.empty();
+            };
+            if (timeout < 0) {
+                m_cv.wait(lock, has_completed);
+            } else if (!m_cv.wait_for(lock, std::chrono::milliseconds(timeout), has_completed)) {
+                return 0;
+            }
+            while (!m_completed_handles.empty() && (max_items == 0 || handles.size() < max_items)) {
+                handles.push_back(m_completed_handles.front());
+                m_completed_handles.pop();
+            }
+        }
+
+        py::list batch;
+        for (const auto& completed : handles) {
+            const auto handle = completed.first;
+            py::object error = py::none();
+            if (completed.second) {
+                // the request failed, its exception is passed instead of being thrown by wait()
+                try {
+                    std::rethrow_exception(completed.second);
+                } catch (const std::exception& e) {
+                    error = py::reinterpret_borrow<py::object>(PyExc_RuntimeError)(e.what());
+                }
+            } else {
+                // wait for request to make sure it returned from callback
+                py::gil_scoped_release release;
+                m_requests[handle].m_request.wait();
+            }
+            batch.append(py::make_tuple(m_requests[handle], m_user_ids[handle], error));
+        }
+
+        try {
+            f_callback(batch);
+        } catch (const py::error_already_set& py_error) {
+            assert(py_error.type());
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_errors.push(py_error);
+        }
+
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& completed : handles) {
+                m_idle_handles.push(completed.first);
+            }
+        }
+        // Notify locks in getIdleRequestId()
+        m_cv.notify_all();
+
+        return handles.size();
+    }
+
     void set_custom_callbacks(py::function f_callback) {
+        set_completion_queue(false);
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -159,6 +265,9 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // finished but not yet processed requests with their exceptions, used only in the completion queue mode
+    std::queue<std::pair<size_t, std::exception_ptr>> m_completed_handles;
+    bool m_completion_queue = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -318,6 +427,62 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_completion_queue",
+            &AsyncInferQueue::set_completion_queue_callbacks,
+            R"(
+            Switches the pool to batched completion mode.
+
+            Finished InferRequests are not passed to a Python callback one by one.
+            Instead they are collected in an internal queue without acquiring the GIL
+            and are handed over in batches by `process_completed`. A request becomes
+            available for the next `start_async` call only after it was processed,
+            so `process_completed` has to be called regularly by a consumer.
+
+            Calling `set_callback` switches the pool back to per-request callbacks,
+            the requests which were not processed yet become idle.
+        )");
+
+    cls.def("process_completed",
+            &AsyncInferQueue::process_completed,
+            py::arg("callback"),
+            py::arg("max_items") = 0,
+            py::arg("timeout") = -1,
+            R"(
+            Calls the callback once for a batch of finished InferRequests.
+            Can be used only after `set_completion_queue` was called.
+
+            Function waits until at least one request is finished, takes up to
+            `max_items` of them and passes them to the callback as a list of
+            (InferRequest, userdata, error) tuples, where error is None or a RuntimeError
+            if the inference of the request failed. After the callback returns, the requests
+            are marked as idle and can be reused by the pool.
+
+            GIL is released while waiting for finished requests.
+
+            .. code-block:: python
+
+                def f(batch):
+                    for request, userdata, error in batch:
+                        if error is None:
+                            print(request.output_tensors[0].data, userdata)
+
+                async_infer_queue.set_completion_queue()
+                ...
+                async_infer_queue.process_completed(f)
+
+            :param callback: Any Python defined function that accepts a list of
+                             (InferRequest, userdata, error) tuples.
+            :type callback: function
+            :param max_items: Maximum number of requests in one batch, 0 means all
+                              requests finished so far. Default: 0
+            :type max_items: int
+            :param timeout: Maximum time in milliseconds to wait for finished
+                            requests, -1 means infinite waiting. Default: -1
+            :type timeout: int
+            :return: Number of processed requests.
+            :rtype: int
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
@@ -62,6 +62,37 @@ ov::Tensor tensor_from_pointer(py::array& array, const ov::Shape& shape, const o
     }
 }
 
+namespace {
+// Memory of the Tensor sharing memory with numpy array is "allocated" from the array. The allocator holds
+// a reference to the array, so the array is alive while the Tensor or any copy of it (e.g. the one set
+// to InferRequest) exists, even if the Python objects of both are deleted.
+class NumpyArrayAllocator : public ov::AllocatorImpl {
+public:
+    explicit NumpyArrayAllocator(const py::array& array) : m_array{array} {}
+
+    ~NumpyArrayAllocator() {
+        // The last copy of the Tensor may be destroyed by any thread, e.g. by the inference callback
+        py::gil_scoped_acquire acquire;
+        m_array.release().dec_ref();
+    }
+
+    void* allocate(const size_t bytes, const size_t) override {
+        OPENVINO_ASSERT(bytes <= static_cast<size_t>(m_array.nbytes()),
+                        "Tensor sharing memory with numpy array can't be bigger than the array");
+        return const_cast<void*>(m_array.data());
+    }
+
+    void deallocate(void*, const size_t, size_t) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    py::array m_array;
+};
+}  // namespace
+
 ov::Tensor tensor_from_numpy(py::array& array, bool shared_memory) {
     // Check if passed array has C-style contiguous memory layout.
     bool is_contiguous = C_CONTIGUOUS == (array.flags() & C_CONTIGUOUS);
@@ -73,8 +104,7 @@ ov::Tensor tensor_from_numpy(py::array& array, bool shared_memory) {
     // users on their side of the code.
     if (shared_memory) {
         if (is_contiguous) {
-            std::vector<size_t> strides(array.strides(), array.strides() + array.ndim());
-            return ov::Tensor(type, shape, const_cast<void*>(array.data(0)), strides);
+            return ov::Tensor(type, shape, ov::Allocator(std::make_shared<NumpyArrayAllocator>(array)));
         } else {
             throw ov::Exception("Tensor with shared memory must be C contiguous!");
         }
@@ -243,10 +273,36 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::array array_from_tensor_shared(const ov::Tensor& tensor) {
+    // The copy of the Tensor owned by the capsule keeps the memory of the tensor alive
+    // as long as the numpy array (or any view of it) exists.
+    auto owner = new ov::Tensor(tensor);
+    py::capsule base(owner, [](void* ptr) {
+        delete reinterpret_cast<ov::Tensor*>(ptr);
+    });
+    const auto& strides = owner->get_strides();
+    return py::array(ov_type_to_dtype().at(owner->get_element_type()),
+                     owner->get_shape(),
+                     std::vector<size_t>(strides.begin(), strides.end()),
+                     owner->data(),
+                     base);
+}
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        if (share_outputs) {
+            // Low precision types are not represented in numpy, so they can't be viewed without conversion.
+            if (t.get_element_type().bitwidth() < 8 || !ov_type_to_dtype().count(t.get_element_type())) {
+                throw py::type_error("Output of type " + t.get_element_type().get_type_name() +
+                                     " can't be shared with numpy array, use share_outputs=False.");
+            }
+            res[py::cast(out)] = array_from_tensor_shared(t);
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
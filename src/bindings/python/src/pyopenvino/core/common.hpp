@@ -46,7 +46,11 @@ void set_request_tensors(ov::InferRequest& request, const py::dict& inputs);
 
 uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request);
+py::array array_from_tensor_shared(const ov::Tensor& tensor);
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs = false);
 
 ov::pass::Serialize::Version convert_to_version(const std::string& version);
 
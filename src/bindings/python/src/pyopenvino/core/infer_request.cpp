@@ -18,14 +18,14 @@ PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
 
 namespace py = pybind11;
 
-inline py::dict run_sync_infer(InferRequestWrapper& self) {
+inline py::dict run_sync_infer(InferRequestWrapper& self, bool share_outputs) {
     {
         py::gil_scoped_release release;
         *self.m_start_time = Time::now();
         self.m_request.infer();
         *self.m_end_time = Time::now();
     }
-    return Common::outputs_to_dict(self.m_outputs, self.m_request);
+    return Common::outputs_to_dict(self.m_outputs, self.m_request, share_outputs);
 }
 
 void regclass_InferRequest(py::module m) {
@@ -38,6 +38,26 @@ void regclass_InferRequest(py::module m) {
             }),
             py::arg("other"));
 
+    // Python API exclusive functions, which track the input tensors set by `share_inputs`
+    cls.def(
+        "_is_shared_input",
+        [](InferRequestWrapper& self, const ov::Tensor& tensor) {
+            return self.m_shared_inputs->count(tensor.data()) != 0;
+        },
+        py::arg("tensor"));
+
+    cls.def(
+        "_set_shared_input",
+        [](InferRequestWrapper& self, const ov::Tensor& tensor, bool shared) {
+            if (shared) {
+                self.m_shared_inputs->insert(tensor.data());
+            } else {
+                self.m_shared_inputs->erase(tensor.data());
+            }
+        },
+        py::arg("tensor"),
+        py::arg("shared"));
+
     // Python API exclusive function
     cls.def(
         "set_tensors",
@@ -171,11 +191,12 @@ void regclass_InferRequest(py::module m) {
     // Overload for single input, it will throw error if a model has more than one input.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const ov::Tensor& inputs) {
+        [](InferRequestWrapper& self, const ov::Tensor& inputs, bool share_outputs) {
             self.m_request.set_input_tensor(inputs);
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -185,6 +206,10 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on single input tensor.
             :type inputs: openvino.runtime.Tensor
+            :param share_outputs: If `True`, returned arrays share memory with output tensors
+                                  of the request instead of copying it. The arrays are
+                                  overwritten by the next inference of this request.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -197,13 +222,14 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self.m_request, inputs);
             // Call Infer function
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -213,6 +239,10 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on input tensors.
             :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param share_outputs: If `True`, returned arrays share memory with output tensors
+                                  of the request instead of copying it. The arrays are
+                                  overwritten by the next inference of this request.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
+#include <unordered_set>
 
 #include <pybind11/pybind11.h>
 
@@ -38,6 +40,7 @@ public:
     ) : m_request{std::move(request)}, m_inputs{inputs}, m_outputs{outputs},
         m_userdata{userdata} {
 
+        m_shared_inputs = std::make_shared<std::unordered_set<const void*>>();
         m_start_time = std::make_shared<Time::time_point>(Time::time_point{});
         m_end_time = std::make_shared<Time::time_point>(Time::time_point{});
 
@@ -83,6 +86,9 @@ public:
     bool m_user_callback_defined = false;
     // Data that is passed by user from Python->C++
     py::object m_userdata;
+    // Data of the input tensors set by `share_inputs`, which share memory with numpy arrays.
+    // The set is shared by all the wrappers of the request, as the request itself.
+    std::shared_ptr<std::unordered_set<const void*>> m_shared_inputs;
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time; // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
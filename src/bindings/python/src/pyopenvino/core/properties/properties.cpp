@@ -29,6 +29,8 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
     wrap_property_RW(m_properties, ov::affinity, "affinity");
     wrap_property_RW(m_properties, ov::force_tbb_terminate, "force_tbb_terminate");
+    wrap_property_RW(m_properties, ov::share_compiled_models, "share_compiled_models");
+    wrap_property_RW(m_properties, ov::enable_latency_statistics, "enable_latency_statistics");
 
     wrap_property_RO(m_properties, ov::supported_properties, "supported_properties");
     wrap_property_RO(m_properties, ov::available_devices, "available_devices");
@@ -38,6 +40,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RO(m_properties, ov::optimal_batch_size, "optimal_batch_size");
     wrap_property_RO(m_properties, ov::max_batch_size, "max_batch_size");
     wrap_property_RO(m_properties, ov::range_for_async_infer_requests, "range_for_async_infer_requests");
+    wrap_property_RO(m_properties, ov::latency_statistics, "latency_statistics");
 
     // Submodule hint
     py::module m_hint =
@@ -74,6 +77,9 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_intel_cpu,
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::keep_fp16_weights, "keep_fp16_weights");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::hw_perf_counters, "hw_perf_counters");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::perf_trace_file, "perf_trace_file");
 
     // Submodule device
     py::module m_device =
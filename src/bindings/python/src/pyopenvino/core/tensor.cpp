@@ -26,9 +26,10 @@ void regclass_Tensor(py::module m) {
 
                 :param array: Array to create tensor from.
                 :type array: numpy.array
-                :param shared_memory: If `True`, this Tensor memory is being shared with a host,
-                                      that means the responsibility of keeping host memory is
-                                      on the side of a user. Any action performed on the host
+                :param shared_memory: If `True`, this Tensor memory is being shared with a host.
+                                      The Tensor and its copies (e.g. set to InferRequest)
+                                      keep a reference to the array, so the array is alive
+                                      while they exist. Any action performed on the host
                                       memory is reflected on this Tensor's memory!
                                       If `False`, data is being copied to this Tensor.
                                       Requires data to be C_CONTIGUOUS if `True`.
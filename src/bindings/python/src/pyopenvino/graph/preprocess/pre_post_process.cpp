@@ -144,6 +144,16 @@ static void regclass_graph_PreProcessSteps(py::module m) {
         },
         py::arg("alg"));
 
+    steps.def(
+        "resize",
+        [](ov::preprocess::PreProcessSteps& self,
+           ov::preprocess::ResizeAlgorithm alg,
+           const std::string& target_size_name) {
+            return &self.resize(alg, target_size_name);
+        },
+        py::arg("alg"),
+        py::arg("target_size_name"));
+
     steps.def(
         "crop",
         [](ov::preprocess::PreProcessSteps& self, const std::vector<int>& begin, const std::vector<int>& end) {
@@ -85,6 +85,10 @@ py::object from_ov_any(const ov::Any& any) {
     else if (any.is<std::map<std::string, int>>()) {
         return py::cast(any.as<std::map<std::string, int>>());
     }
+    // Check for std::map<std::string, std::map<std::string, double>>
+    else if (any.is<std::map<std::string, std::map<std::string, double>>>()) {
+        return py::cast(any.as<std::map<std::string, std::map<std::string, double>>>());
+    }
     // Check for std::vector<ov::PropertyName>
     else if (any.is<std::vector<ov::PropertyName>>()) {
         auto val = any.as<std::vector<ov::PropertyName>>();
@@ -444,6 +444,24 @@ def test_graph_preprocess_resize_algorithm():
     assert np.equal(output, expected_output).all()
 
 
+def test_graph_preprocess_resize_runtime_size():
+    shape = [1, 3, -1, -1]
+    parameter_a = ops.parameter(shape, dtype=np.float32, name="A")
+    model = ops.relu(parameter_a)
+    function = Model(model, [parameter_a], "TestFunction")
+
+    ppp = PrePostProcessor(function)
+    inp = ppp.input()
+    inp.tensor().set_layout(ov.Layout("NCHW")).set_spatial_dynamic_shape()
+    inp.preprocess().resize(ResizeAlgorithm.RESIZE_LINEAR, "target_size")
+    function = ppp.build()
+
+    assert len(function.get_parameters()) == 2
+    assert function.input(1).get_any_name() == "target_size"
+    assert function.input(1).get_element_type() == Type.i64
+    assert function.input(1).get_partial_shape() == ov.PartialShape([2])
+
+
 def test_graph_preprocess_model():
     model = bytes(b"""<net name="add_model" version="10">
     <layers>
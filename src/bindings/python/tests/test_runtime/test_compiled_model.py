@@ -11,6 +11,7 @@ from tests.test_utils.test_utils import generate_image
 from openvino.runtime import Model, ConstOutput, Shape
 
 from openvino.runtime import Core, Tensor
+from openvino.runtime import properties
 
 is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
 test_net_xml, test_net_bin = model_path(is_myriad)
@@ -253,6 +254,23 @@ def test_infer_new_request_numpy(device):
     assert np.argmax(res[list(res)[0]]) == 9
 
 
+def test_latency_statistics(device):
+    core = Core()
+    model = core.read_model(model=test_net_xml, weights=test_net_bin)
+    img = generate_image()
+    compiled_model = core.compile_model(model, device)
+    assert not compiled_model.get_property(properties.enable_latency_statistics())
+    compiled_model.set_property({properties.enable_latency_statistics(): True})
+    request = compiled_model.create_infer_request()
+    for _ in range(3):
+        request.infer({"data": img})
+    statistics = compiled_model.get_property(properties.latency_statistics())
+    assert statistics["total"]["count"] == 3
+    assert statistics["execution"]["p50"] <= statistics["execution"]["p99"]
+    compiled_model.set_property({properties.enable_latency_statistics(): False})
+    assert compiled_model.get_property(properties.latency_statistics()) == {}
+
+
 def test_infer_new_request_tensor_numpy_copy(device):
     core = Core()
     model = core.read_model(model=test_net_xml, weights=test_net_bin)
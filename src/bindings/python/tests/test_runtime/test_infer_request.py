@@ -9,6 +9,7 @@ import os
 import pytest
 import datetime
 import time
+import gc
 
 import openvino.runtime.opset8 as ops
 from openvino.runtime import Core, AsyncInferQueue, Tensor, ProfilingInfo, Model, InferRequest
@@ -477,6 +478,66 @@ def test_infer_queue(device):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+def test_infer_queue_process_completed(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [{"finished": False, "latency": 0} for _ in range(jobs)]
+    batch_sizes = []
+
+    def callback(batch):
+        batch_sizes.append(len(batch))
+        for request, job_id, error in batch:
+            assert error is None
+            jobs_done[job_id]["finished"] = True
+            jobs_done[job_id]["latency"] = request.latency
+
+    img = generate_image()
+    infer_queue.set_completion_queue()
+    for i in range(jobs):
+        if not infer_queue.is_ready():
+            infer_queue.process_completed(callback)
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    while sum(batch_sizes) < jobs:
+        assert infer_queue.process_completed(callback, max_items=2) <= 2
+    assert infer_queue.process_completed(callback, timeout=0) == 0
+    assert all(job["finished"] for job in jobs_done)
+    assert all(job["latency"] > 0 for job in jobs_done)
+
+
+def test_infer_queue_set_callback_after_completion_queue(device):
+    jobs = 8
+    num_request = 2
+    core = Core()
+    model = core.read_model(test_net_xml, test_net_bin)
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [{"finished": False} for _ in range(jobs)]
+
+    def callback(request, job_id):
+        jobs_done[job_id]["finished"] = True
+
+    img = generate_image()
+    infer_queue.set_completion_queue()
+    for i in range(num_request):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    # requests which were not processed become idle when the mode is switched
+    infer_queue.set_callback(callback)
+    for i in range(num_request, jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert not any(job["finished"] for job in jobs_done[:num_request])
+    assert all(job["finished"] for job in jobs_done[num_request:])
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.process_completed(lambda batch: None, timeout=0)
+    assert "set_completion_queue" in str(e.value)
+
+
 def test_infer_queue_is_ready(device):
     core = Core()
     param = ops.parameter([10])
@@ -981,3 +1042,108 @@ def test_convert_infer_request(device):
     with pytest.raises(TypeError) as e:
         deepcopy(res)
     assert "cannot deepcopy 'openvino.runtime.ConstOutput' object." in str(e)
+
+
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_infer_share_inputs(device, share_inputs):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer({0: arr_1, 1: arr_2}, share_inputs=share_inputs)
+    assert np.array_equal(res[request.model_outputs[0]], arr_1 + arr_2)
+
+    tensor = request.get_input_tensor(0)
+    assert np.shares_memory(tensor.data, arr_1) == share_inputs
+
+
+def test_infer_share_inputs_not_contiguous(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    arr_1 = np.asfortranarray(arr_1)
+
+    res = request.infer([arr_1, arr_2], share_inputs=True)
+    assert np.array_equal(res[request.model_outputs[0]], arr_1 + arr_2)
+    assert not np.shares_memory(request.get_input_tensor(0).data, arr_1)
+    assert np.shares_memory(request.get_input_tensor(1).data, arr_2)
+
+
+def test_infer_copy_inputs_after_shared(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    arr_1_expected = arr_1.copy()
+    arr_2_expected = arr_2.copy()
+
+    request.infer([arr_1, arr_2], share_inputs=True)
+    assert np.shares_memory(request.get_input_tensor(0).data, arr_1)
+
+    new_arr_1 = np.full([2, 2], 10, dtype=np.float32)
+    new_arr_2 = np.full([2, 2], 20, dtype=np.float32)
+    res = request.infer([new_arr_1, new_arr_2])
+    assert np.array_equal(res[request.model_outputs[0]], new_arr_1 + new_arr_2)
+
+    # Arrays shared with the previous inference are not overwritten by copying
+    assert not np.shares_memory(request.get_input_tensor(0).data, arr_1)
+    assert np.array_equal(arr_1, arr_1_expected)
+    assert np.array_equal(arr_2, arr_2_expected)
+
+    # Next copying inferences write into the tensor which replaced the shared one
+    tensor = request.get_input_tensor(0)
+    request.infer([arr_1, arr_2])
+    assert np.shares_memory(request.get_input_tensor(0).data, tensor.data)
+    assert np.array_equal(tensor.data, arr_1)
+
+
+def test_infer_copy_inputs_to_request_tensor(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    tensor = request.get_input_tensor(0)
+
+    request.infer([arr_1, arr_2])
+    assert np.shares_memory(request.get_input_tensor(0).data, tensor.data)
+    assert np.array_equal(tensor.data, arr_1)
+
+
+def test_infer_share_inputs_keeps_array_alive(device):
+    request, _, arr_2 = create_simple_request_and_inputs(device)
+    arr_1 = np.full([2, 2], 3, dtype=np.float32)
+
+    res_1 = request.infer([arr_1, arr_2], share_inputs=True)
+    expected = res_1[request.model_outputs[0]].copy()
+
+    # The request keeps the array set by `share_inputs`, it is used by the next inference
+    del arr_1
+    gc.collect()
+    assert np.array_equal(request.get_input_tensor(0).data, np.full([2, 2], 3, dtype=np.float32))
+    res_2 = request.infer()
+    assert np.array_equal(res_2[request.model_outputs[0]], expected)
+
+
+@pytest.mark.parametrize("share_outputs", [True, False])
+def test_infer_share_outputs(device, share_outputs):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer([arr_1, arr_2], share_outputs=share_outputs)
+    output = res[request.model_outputs[0]]
+    assert np.array_equal(output, arr_1 + arr_2)
+    assert np.shares_memory(output, request.get_output_tensor().data) == share_outputs
+
+    # Shared arrays keep the memory of the output tensor alive
+    del request
+    assert np.array_equal(output, arr_1 + arr_2)
+
+
+def test_infer_queue_share_inputs(device):
+    jobs = 4
+    input_shape = [2, 2]
+    param = ops.parameter(input_shape, np.float32)
+    model = Model(ops.abs(param), [param])
+    compiled_model = Core().compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, jobs)
+    inputs = [np.full(input_shape, -i, dtype=np.float32) for i in range(jobs)]
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_callback(callback)
+    for i in range(jobs):
+        infer_queue.start_async({0: inputs[i]}, i, share_inputs=True)
+    infer_queue.wait_all()
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.abs(inputs[i]))
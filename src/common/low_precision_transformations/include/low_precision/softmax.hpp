@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "layer_transformation.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief SoftmaxTransformation keeps dequantization operations in front of Softmax operation, so the operation can be
+ * executed on low precision data by the plugin. The Subtract is removed, since Softmax is invariant to the shift.
+ *
+ * For more details about the transformation, refer to
+ * [SoftmaxTransformation](@ref openvino_docs_OV_UG_lpt_SoftmaxTransformation) page
+ * in the Inference Engine Developer Guide.
+ */
+class LP_TRANSFORMATIONS_API SoftmaxTransformation : public LayerTransformation {
+public:
+    OPENVINO_RTTI("SoftmaxTransformation", "0");
+    SoftmaxTransformation(const Params& params = Params());
+    bool transform(TransformationContext &context, ngraph::pattern::Matcher &m) override;
+    bool canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> layer) const override;
+    bool isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept override;
+};
+
+}  // namespace low_precision
+}  // namespace pass
+}  // namespace ngraph
@@ -214,6 +214,7 @@ bool ngraph::pass::low_precision::MarkupPrecisions::isSupported(const std::share
         { name<opset1::Reshape>() },
         { name<opset1::Squeeze>() },
         { name<opset1::ShuffleChannels>() },
+        { name<opset1::Softmax>() },
         { name<opset1::Split>() },
         { name<opset1::StridedSlice>() },
         // ?
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/softmax.hpp"
+
+#include <memory>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "low_precision/network_helper.hpp"
+#include "low_precision/rt_info/skip_cleanup_attribute.hpp"
+#include "itt.hpp"
+
+using namespace ngraph;
+using namespace ngraph::pass;
+using namespace ngraph::pass::low_precision;
+
+SoftmaxTransformation::SoftmaxTransformation(const Params& params) : LayerTransformation(params) {
+    MATCHER_SCOPE(SoftmaxTransformation);
+    auto matcher = pattern::wrap_type<opset1::Softmax>({ pattern::wrap_type<opset1::Multiply>() });
+
+    ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+        auto op = m.get_match_root();
+        if (transformation_callback(op)) {
+            return false;
+        }
+        return transform(*context, m);
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matcher, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+bool SoftmaxTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> operation) const {
+    if (!LayerTransformation::canBeTransformed(context, operation)) {
+        return false;
+    }
+
+    const auto softmax = ov::as_type_ptr<opset1::Softmax>(operation);
+    if (!softmax) {
+        return false;
+    }
+
+    // the plugin applies a single scale to the low precision data
+    const auto dequantization = NetworkHelper::getDequantization(operation, defaultPrecisions);
+    if (dequantization.empty() || (dequantization.multiply == nullptr) ||
+        !NetworkHelper::isScalarLike(dequantization.multiplyConstant)) {
+        return false;
+    }
+
+    if (dequantization.subtract == nullptr) {
+        return true;
+    }
+
+    // the subtract is removed, so it must not change the precision of the data
+    if (dequantization.subtract->get_input_element_type(0) != dequantization.subtract->get_output_element_type(0)) {
+        return false;
+    }
+
+    // softmax(x - shift) == softmax(x) if the shift is the same for all the values along the axis
+    const auto rank = operation->get_input_partial_shape(0).rank();
+    if (rank.is_dynamic()) {
+        return false;
+    }
+    const Shape& shiftShape = dequantization.subtractConstant->get_shape();
+    const int64_t axis = static_cast<int64_t>(softmax->get_axis()) - (rank.get_length() - static_cast<int64_t>(shiftShape.size()));
+    return (axis < 0) || (shiftShape[axis] == 1ul);
+}
+
+bool SoftmaxTransformation::transform(TransformationContext &context, ngraph::pattern::Matcher &m) {
+    std::shared_ptr<Node> softmax = m.get_match_root();
+    if (!canBeTransformed(context, softmax)) {
+        return false;
+    }
+
+    softmax = NetworkHelper::separateInStandaloneBranch(softmax, defaultPrecisions);
+
+    const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(softmax, defaultPrecisions);
+    if (dequantization.subtract != nullptr) {
+        dequantization.multiply->input(0).replace_source_output(dequantization.subtract->input_value(0));
+    }
+
+    // the dequantization is executed together with Softmax, so it must not be fused back to FakeQuantize
+    SkipCleanupAttribute::create(dequantization.multiply);
+    if (dequantization.convert != nullptr) {
+        SkipCleanupAttribute::create(dequantization.convert);
+    }
+    return true;
+}
+
+bool SoftmaxTransformation::isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept {
+    return false;
+}
@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_transformation.hpp"
+
+#include <string>
+#include <sstream>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <transformations/utils/utils.hpp>
+#include <low_precision/softmax.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "simple_low_precision_transformer.hpp"
+#include "lpt_ngraph_functions/softmax_function.hpp"
+#include "lpt_ngraph_functions/common/dequantization_operations.hpp"
+
+namespace {
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass;
+
+class SoftmaxTransformationTestValues {
+public:
+    class Actual {
+    public:
+        ngraph::element::Type precisionBeforeDequantization;
+        ngraph::builder::subgraph::DequantizationOperations dequantization;
+    };
+
+    class Expected {
+    public:
+        ngraph::element::Type precisionBeforeDequantization;
+        ngraph::builder::subgraph::DequantizationOperations dequantization;
+    };
+
+    size_t axis;
+    TestTransformationParams params;
+    Actual actual;
+    Expected expected;
+};
+
+typedef std::tuple<
+    ngraph::PartialShape,
+    SoftmaxTransformationTestValues> SoftmaxTransformationParams;
+
+class SoftmaxTransformation : public LayerTransformation, public testing::WithParamInterface<SoftmaxTransformationParams> {
+public:
+    void SetUp() override {
+        const ngraph::PartialShape inputShape = std::get<0>(GetParam());
+        const SoftmaxTransformationTestValues testValues = std::get<1>(GetParam());
+
+        actualFunction = ngraph::builder::subgraph::SoftmaxFunction::get(
+            testValues.actual.precisionBeforeDequantization,
+            inputShape,
+            testValues.axis,
+            testValues.actual.dequantization);
+
+        SimpleLowPrecisionTransformer transformer;
+        transformer.add<ngraph::pass::low_precision::SoftmaxTransformation, ngraph::opset1::Softmax>(testValues.params);
+        transformer.transform(actualFunction);
+
+        referenceFunction = ngraph::builder::subgraph::SoftmaxFunction::get(
+            testValues.expected.precisionBeforeDequantization,
+            inputShape,
+            testValues.axis,
+            testValues.expected.dequantization);
+    }
+
+    static std::string getTestCaseName(testing::TestParamInfo<SoftmaxTransformationParams> obj) {
+        const ngraph::PartialShape inputShape = std::get<0>(obj.param);
+        const SoftmaxTransformationTestValues testValues = std::get<1>(obj.param);
+
+        std::ostringstream result;
+        result <<
+            toString(testValues.params) << "_" <<
+            inputShape << "_" <<
+            testValues.axis << "_" <<
+            testValues.actual.precisionBeforeDequantization << "_" <<
+            testValues.actual.dequantization << "_" <<
+            testValues.expected.dequantization;
+        return result.str();
+    }
+};
+
+TEST_P(SoftmaxTransformation, CompareFunctions) {
+    actualFunction->validate_nodes_and_infer_types();
+    auto res = compare_functions(actualFunction, referenceFunction, true, true, false);
+    ASSERT_TRUE(res.first) << res.second;
+
+    ASSERT_TRUE(LayerTransformation::allNamesAreUnique(actualFunction)) << "Not all names are unique";
+}
+
+const std::vector<ngraph::PartialShape> inputShapes = {
+    { 1, 4, 16, 16 },
+    { -1, -1, -1, -1 },
+};
+
+const std::vector<SoftmaxTransformationTestValues> testValues = {
+    // per-tensor zero point is removed
+    {
+        3,
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {128.f}, {0.02f}}
+        },
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {}, {0.02f}}
+        }
+    },
+    // per-channel zero point is the same along the axis
+    {
+        3,
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {
+                {ngraph::element::f32},
+                {{128.f, 64.f, 32.f, 16.f}, ngraph::element::f32, ngraph::Shape{ 1, 4, 1, 1 }},
+                {0.02f}
+            }
+        },
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {}, {0.02f}}
+        }
+    },
+    // per-channel zero point along the axis
+    {
+        1,
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {
+                {ngraph::element::f32},
+                {{128.f, 64.f, 32.f, 16.f}, ngraph::element::f32, ngraph::Shape{ 1, 4, 1, 1 }},
+                {0.02f}
+            }
+        },
+        {
+            ngraph::element::u8,
+            {
+                {ngraph::element::f32},
+                {{128.f, 64.f, 32.f, 16.f}, ngraph::element::f32, ngraph::Shape{ 1, 4, 1, 1 }},
+                {0.02f}
+            }
+        }
+    },
+    // per-channel scale
+    {
+        3,
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::i8,
+            {
+                {ngraph::element::f32},
+                {16.f},
+                {{0.01f, 0.02f, 0.03f, 0.04f}, ngraph::element::f32, ngraph::Shape{ 1, 4, 1, 1 }}
+            }
+        },
+        {
+            ngraph::element::i8,
+            {
+                {ngraph::element::f32},
+                {16.f},
+                {{0.01f, 0.02f, 0.03f, 0.04f}, ngraph::element::f32, ngraph::Shape{ 1, 4, 1, 1 }}
+            }
+        }
+    },
+    // scale only
+    {
+        3,
+        LayerTransformation::createParamsI8I8(),
+        {
+            ngraph::element::i8,
+            {{ngraph::element::f32}, {}, {0.02f}}
+        },
+        {
+            ngraph::element::i8,
+            {{ngraph::element::f32}, {}, {0.02f}}
+        }
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_LPT,
+    SoftmaxTransformation,
+    ::testing::Combine(
+        ::testing::ValuesIn(inputShapes),
+        ::testing::ValuesIn(testValues)),
+    SoftmaxTransformation::getTestCaseName);
+} // namespace
@@ -16,7 +16,7 @@ ov::pass::DisableDecompressionConvertConstantFolding::DisableDecompressionConver
 
     ov::matcher_pass_callback callback = [=](pattern::Matcher& m) {
         const auto& node = m.get_match_root();
-        if (!ov::is_decompression(node))
+        if (!ov::is_decompression(node) || transformation_callback(node))
             return false;
         disable_constant_folding(node);
         return true;
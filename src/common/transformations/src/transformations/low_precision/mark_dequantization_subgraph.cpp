@@ -44,6 +44,10 @@ ov::pass::MarkDequantizationSubgraph::MarkDequantizationSubgraph(const element::
             }
         }
 
+        if (transformation_callback(m.get_match_root())) {
+            return false;
+        }
+
         const auto& input = pattern_map.at(input_pattern);
         std::vector<Node*> tmp;
         if (ngraph::could_propagate(input, tmp)) {
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief This class represents a read-only memory mapping of a whole file
+ */
+class MappedMemory {
+public:
+    /**
+     * @brief Returns a pointer to the beginning of the mapped region
+     * @return Pointer to the mapped data or nullptr for empty files
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns the size of the mapped region in bytes
+     * @return Size of the mapped file
+     */
+    virtual size_t size() const noexcept = 0;
+
+    virtual ~MappedMemory() = default;
+};
+
+/**
+ * @brief Maps the whole file into memory in read-only mode
+ * @param path Path to the file
+ * @return Reference to the mapped memory, the mapping lives while the reference is alive
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file specified by a wide char path into memory in read-only mode
+ * @param path Path to the file
+ * @return Reference to the mapped memory, the mapping lives while the reference is alive
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
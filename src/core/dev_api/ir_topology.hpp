@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ov {
+namespace ir_topology {
+
+/**
+ * @brief Binary topology of the top-level model of IR which is optionally appended to the end of the weights file:
+ *
+ *     [ Weights ][ Header ][ Layers ][ Ports ][ Dims ][ Attributes ][ Edges ][ Strings ][ Trailer ]
+ *
+ * The layers and the edges duplicate the ones of the xml file in the same order, so the generic layer parameters,
+ * the attributes of the operations and the graph connectivity are available without parsing the xml. The layers
+ * with other content (bodies of sub-graphs, runtime info) are marked, only such layers are parsed from the xml.
+ * All the records have a fixed size and are
+ * 8-byte aligned relative to the beginning of the weights file, so the section is used in place. The strings are
+ * offsets of null-terminated strings in the string pool. The section is valid only for the xml file with the size
+ * and the hash stored in the header, the weights files written without it are not affected.
+ */
+struct Header {
+    uint64_t xml_size;
+    uint64_t xml_hash;
+    // offsets are relative to the beginning of the header
+    uint64_t layers_count;
+    uint64_t layers_offset;
+    uint64_t ports_count;
+    uint64_t ports_offset;
+    uint64_t dims_count;
+    uint64_t dims_offset;
+    uint64_t attributes_count;
+    uint64_t attributes_offset;
+    uint64_t edges_count;
+    uint64_t edges_offset;
+    uint64_t strings_size;
+    uint64_t strings_offset;
+};
+
+struct Layer {
+    uint64_t id;
+    uint32_t name;
+    uint32_t type;
+    uint32_t version;
+    // the output ports go first
+    uint32_t first_port;
+    uint32_t outputs_count;
+    uint32_t inputs_count;
+    // attributes of the "data" element of the layer
+    uint32_t first_attribute;
+    uint32_t attributes_count;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+// The layer has no xml content other than the ports and the attributes of the operation,
+// so it's completely described by the records
+constexpr uint32_t complete_layer = 1;
+
+struct Port {
+    uint64_t id;
+    // empty for the input ports
+    uint32_t precision;
+    // value of the "names" attribute as is
+    uint32_t names;
+    uint32_t first_dim;
+    uint32_t dims_count;
+};
+
+using Dim = int64_t;
+
+struct Attribute {
+    uint32_t name;
+    uint32_t value;
+};
+
+struct Edge {
+    uint64_t from_layer;
+    uint64_t from_port;
+    uint64_t to_layer;
+    uint64_t to_port;
+};
+
+struct Trailer {
+    // size of the section without the trailer
+    uint64_t size;
+    char magic[8];
+};
+
+constexpr size_t alignment = 8;
+
+inline const char* magic() {
+    return "OVTOPO02";
+}
+
+/// \brief FNV-1a hash of the xml text taken by 8-byte words, so it's cheap compared to the parsing of the text
+inline uint64_t hash(const char* data, size_t size) {
+    uint64_t result = 14695981039346656037ull;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        result ^= word;
+        result *= 1099511628211ull;
+    }
+    for (; i < size; i++) {
+        result ^= static_cast<uint8_t>(data[i]);
+        result *= 1099511628211ull;
+    }
+    return result;
+}
+
+template <class T>
+const T* records(const Header* header, uint64_t offset) {
+    return reinterpret_cast<const T*>(reinterpret_cast<const char*>(header) + offset);
+}
+
+/// \brief Finds and validates the section at the end of the weights
+/// \return pointer to the header or nullptr if the weights have no section
+inline const Header* find(const char* weights, size_t size) {
+    Trailer trailer;
+    if (weights == nullptr || size < sizeof(Trailer) + sizeof(Header))
+        return nullptr;
+    std::memcpy(&trailer, weights + size - sizeof(Trailer), sizeof(Trailer));
+    if (std::memcmp(trailer.magic, magic(), sizeof(trailer.magic)) != 0 || trailer.size < sizeof(Header) ||
+        trailer.size > size - sizeof(Trailer))
+        return nullptr;
+    const size_t offset = size - sizeof(Trailer) - trailer.size;
+    if (offset % alignment != 0 || reinterpret_cast<uintptr_t>(weights) % alignment != 0)
+        return nullptr;
+
+    const auto header = reinterpret_cast<const Header*>(weights + offset);
+    const auto fits = [&](uint64_t begin, uint64_t count, size_t item_size) {
+        return begin % alignment == 0 && begin <= trailer.size && count <= (trailer.size - begin) / item_size;
+    };
+    if (!fits(header->layers_offset, header->layers_count, sizeof(Layer)) ||
+        !fits(header->ports_offset, header->ports_count, sizeof(Port)) ||
+        !fits(header->dims_offset, header->dims_count, sizeof(Dim)) ||
+        !fits(header->attributes_offset, header->attributes_count, sizeof(Attribute)) ||
+        !fits(header->edges_offset, header->edges_count, sizeof(Edge)) ||
+        !fits(header->strings_offset, header->strings_size, 1))
+        return nullptr;
+
+    // the records refer to each other by indices
+    const auto strings = records<char>(header, header->strings_offset);
+    if (header->strings_size == 0 || strings[header->strings_size - 1] != '\0')
+        return nullptr;
+    const auto ports = records<Port>(header, header->ports_offset);
+    for (uint64_t i = 0; i < header->ports_count; i++) {
+        if (ports[i].precision >= header->strings_size || ports[i].names >= header->strings_size ||
+            ports[i].first_dim > header->dims_count || ports[i].dims_count > header->dims_count - ports[i].first_dim)
+            return nullptr;
+    }
+    const auto attributes = records<Attribute>(header, header->attributes_offset);
+    for (uint64_t i = 0; i < header->attributes_count; i++) {
+        if (attributes[i].name >= header->strings_size || attributes[i].value >= header->strings_size)
+            return nullptr;
+    }
+    const auto layers = records<Layer>(header, header->layers_offset);
+    for (uint64_t i = 0; i < header->layers_count; i++) {
+        const uint64_t ports_count = static_cast<uint64_t>(layers[i].outputs_count) + layers[i].inputs_count;
+        if (layers[i].name >= header->strings_size || layers[i].type >= header->strings_size ||
+            layers[i].version >= header->strings_size || layers[i].first_port > header->ports_count ||
+            ports_count > header->ports_count - layers[i].first_port ||
+            layers[i].first_attribute > header->attributes_count ||
+            layers[i].attributes_count > header->attributes_count - layers[i].first_attribute)
+            return nullptr;
+    }
+    return header;
+}
+
+}  // namespace ir_topology
+}  // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief Threading backend used by the core components (reference kernels, frontends, etc.)
+ *
+ * The core doesn't depend on a threading library: by default the work is run on a pool of threads which are created
+ * once and reused by all the calls, and the runtime replaces the executor with the one built on its threading
+ * interface (TBB or OpenMP), so the core shares the threads with the plugins.
+ */
+struct ParallelExecutor {
+    /// Returns the number of threads available to the calling thread
+    std::function<size_t()> get_max_threads;
+    /// Calls func(ithr, nthr) for every ithr in [0, nthr) and waits for all of the calls
+    std::function<void(size_t nthr, const std::function<void(size_t, size_t)>& func)> run;
+};
+
+/// \brief The total cost of the work (e.g. the number of processed elements) below which the work is done
+/// in the calling thread: it is done faster than the threads are woken up
+constexpr size_t min_parallel_work = 1 << 15;
+
+/// \brief Replaces the executor, an executor with empty functions restores the default one
+/// \return the previous executor
+OPENVINO_API ParallelExecutor set_parallel_executor(ParallelExecutor executor);
+
+/// \brief Returns the number of threads available to the calling thread
+OPENVINO_API size_t get_max_threads();
+
+/// \brief Calls func(ithr, nthr) for every ithr in [0, nthr) in parallel and waits for all of the calls
+OPENVINO_API void parallel_nt(size_t nthr, const std::function<void(size_t ithr, size_t nthr)>& func);
+
+/// \brief Calls func(i) for every i in [0, work_amount), the range is split evenly between the threads
+/// \param item_cost Estimated cost of func(i), e.g. the number of processed elements; every thread gets at least
+/// min_parallel_work of the total cost, so the small work is done in the calling thread
+OPENVINO_API void parallel_for(size_t work_amount, size_t item_cost, const std::function<void(size_t)>& func);
+
+/// \brief Splits the range [0, work_amount) between nthr threads
+/// \return the range [begin, end) of the thread ithr
+inline void splitter(size_t work_amount, size_t nthr, size_t ithr, size_t& begin, size_t& end) {
+    const size_t chunk = work_amount / nthr;
+    const size_t rest = work_amount % nthr;
+    begin = ithr * chunk + (ithr < rest ? ithr : rest);
+    end = begin + chunk + (ithr < rest ? 1 : 0);
+}
+
+}  // namespace threading
+}  // namespace ov
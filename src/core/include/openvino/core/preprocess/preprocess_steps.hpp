@@ -115,6 +115,17 @@ public:
     /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
     PreProcessSteps& resize(ResizeAlgorithm alg);
 
+    /// \brief Add resize operation to dimensions provided at inference time. Adds new model input with specified
+    /// tensor name, element type `i64` and shape `{2}` which holds target {height, width} of resized image. This allows
+    /// resizing of images with dynamic width/height and models with dynamic spatial dimensions.
+    ///
+    /// \param alg Resize algorithm.
+    ///
+    /// \param target_size_name Tensor name of new model input with target size.
+    ///
+    /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+    PreProcessSteps& resize(ResizeAlgorithm alg, const std::string& target_size_name);
+
     /// \brief Crop input tensor between begin and end coordinates. Under the hood, inserts `opset8::Slice` operation to
     /// execution graph. It is recommended to use to together with `ov::preprocess::InputTensorInfo::set_shape` to set
     /// original input shape before cropping
@@ -21,6 +21,9 @@ namespace pass {
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - if binary_topology is set, the topology of the model is also appended to the end of the bin file,
+ * it allows to load the model without parsing of the layers of the xml file, except the ones with sub-graphs or
+ * runtime info
  * \ingroup ov_pass_cpp_api
  */
 class OPENVINO_API Serialize : public ov::pass::ModelPass {
@@ -40,6 +43,7 @@ public:
               std::map<std::string, ngraph::OpSet> custom_opsets,
               Version version = Version::UNSPECIFIED);
     Serialize(std::ostream& xmlFile, std::ostream& binFile, Version version = Version::UNSPECIFIED);
+    Serialize(std::ostream& xmlFile, std::ostream& binFile, Version version, bool binary_topology);
 
     OPENVINO_DEPRECATED("This constructor is deprecated. Please use new extension API")
     Serialize(const std::string& xmlPath,
@@ -47,6 +51,7 @@ public:
               std::map<std::string, ngraph::OpSet> custom_opsets,
               Version version = Version::UNSPECIFIED);
     Serialize(const std::string& xmlPath, const std::string& binPath, Version version = Version::UNSPECIFIED);
+    Serialize(const std::string& xmlPath, const std::string& binPath, Version version, bool binary_topology);
 
 private:
     std::ostream* m_xmlFile;
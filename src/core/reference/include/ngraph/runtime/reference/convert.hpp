@@ -105,6 +105,10 @@ void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count);
 template <>
 void convert<float16, float>(const float16* arg, float* out, size_t count);
 template <>
+void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count);
+template <>
+void convert<int8_t, float>(const int8_t* arg, float* out, size_t count);
+template <>
 void convert<float, int8_t>(const float* arg, int8_t* out, size_t count);
 template <>
 void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
@@ -16,6 +16,7 @@
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph {
@@ -234,15 +235,16 @@ void convolution(const T* in,
     const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
     const size_t filter_size = shape_size(filter_shape);
 
-    auto batch = in;
-    for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx) {
-        auto filter = f;
-        for (size_t f_idx = 0; f_idx < filters_count; ++f_idx) {
-            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-            filter += filter_size;
+    // every (batch, filter) pair produces an independent output channel
+    const size_t out_channel_size = shape_size(Shape{std::next(out_shape.begin(), 2), std::end(out_shape)});
+    parallel_chunks(batches_count * filters_count, out_channel_size * filter_size, [&](size_t begin, size_t end) {
+        for (size_t item = begin; item < end; ++item) {
+            const auto batch = in + (item / filters_count) * batch_size;
+            const auto filter = f + (item % filters_count) * filter_size;
+            auto out_channel = out + item * out_channel_size;
+            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out_channel);
         }
-        batch += batch_size;
-    }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
@@ -11,31 +12,33 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace details {
-template <typename T>
-void dot(const T* arg0,
-         const T* arg1,
-         T* out,
-         const Shape& arg0_shape,
-         const Shape& arg1_shape,
-         const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
+// 2D inputs shapes are interpreted as {I, K} x {K, J}
+// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+inline void get_dot_dims(const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         size_t& I_dim,
+                         size_t& J_dim,
+                         size_t& K_dim) {
     const size_t arg0_rank = arg0_shape.size();
     const size_t arg1_rank = arg1_shape.size();
+    I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
+    J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
+    K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+}
 
-    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-    const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
-
-    for (size_t i = 0; i < I_dim; ++i) {
+// Computes the rows [i_begin, i_end) of the output, the rows are independent from each other
+template <typename T>
+void dot_rows(const T* arg0, const T* arg1, T* out, size_t J_dim, size_t K_dim, size_t i_begin, size_t i_end) {
+    std::fill(out + i_begin * J_dim, out + i_end * J_dim, T{0});
+    for (size_t i = i_begin; i < i_end; ++i) {
         for (size_t k = 0; k < K_dim; ++k) {
             const size_t a_idx = i * K_dim + k;
             for (size_t j = 0; j < J_dim; ++j) {
@@ -47,6 +50,20 @@ void dot(const T* arg0,
     }
 }
 
+template <typename T>
+void dot(const T* arg0,
+         const T* arg1,
+         T* out,
+         const Shape& arg0_shape,
+         const Shape& arg1_shape,
+         const Shape& out_shape) {
+    size_t I_dim, J_dim, K_dim;
+    get_dot_dims(arg0_shape, arg1_shape, I_dim, J_dim, K_dim);
+    parallel_chunks(I_dim, J_dim * K_dim, [&](size_t begin, size_t end) {
+        dot_rows(arg0, arg1, out, J_dim, K_dim, begin, end);
+    });
+}
+
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
 }  // namespace details
 /// \brief Reference kernel for matmul computation.
@@ -208,14 +225,23 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    // the rows of all the batches are distributed between threads at once
+    size_t I_dim, J_dim, K_dim;
+    details::get_dot_dims(dot_arg0_shape, dot_arg1_shape, I_dim, J_dim, K_dim);
+    parallel_chunks(output_batch_size * I_dim, J_dim * K_dim, [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end;) {
+            const size_t batch = row / I_dim;
+            const size_t i_end = std::min(end, (batch + 1) * I_dim);
+            details::dot_rows(arg0_data + batch * arg0_offset,
+                              arg1_data + batch * arg1_offset,
+                              out + batch * output_offset,
+                              J_dim,
+                              K_dim,
+                              row - batch * I_dim,
+                              i_end - batch * I_dim);
+            row = i_end;
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
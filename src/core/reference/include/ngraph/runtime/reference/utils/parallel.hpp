@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Splits the range [0, work_amount) of independent work items into contiguous chunks and calls func for
+///        every chunk, the chunks are processed in parallel when the total work is large enough.
+///
+/// \param work_amount Number of work items.
+/// \param item_cost   Estimated cost of a single work item, e.g. number of processed elements.
+/// \param func        Callable with the signature void(size_t begin, size_t end).
+///
+/// The results don't depend on the number of threads as long as the work items write disjoint parts of the output.
+void parallel_chunks(size_t work_amount, size_t item_cost, const std::function<void(size_t, size_t)>& func);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -5,201 +5,108 @@
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include "ngraph/check.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
 namespace {
-void reshape_in0(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    memcpy(out, in, elem_size);
-}
-
-void reshape_in1(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    size_t size[1];
-    size_t in_index[1];
-    size_t* map_index[1];
-    for (size_t i = 0; i < 1; i++) {
-        size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
-    }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        memcpy(out, in + *map_index[0] * elem_size, elem_size);
-        out += elem_size;
+template <typename T>
+void copy_strided_row(const char* in, char* out, size_t count, size_t in_stride) {
+    // fixed size copies are compiled into plain moves, the strides are given in bytes
+    for (size_t i = 0; i < count; ++i) {
+        std::memcpy(out, in, sizeof(T));
+        in += in_stride;
+        out += sizeof(T);
     }
 }
 
-void reshape_in2(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    size_t size[2];
-    size_t in_index[2];
-    size_t* map_index[2];
-    for (size_t i = 0; i < 2; i++) {
-        size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
-    }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-            // clang-format on
-        }
+void copy_row(const char* in, char* out, size_t count, size_t in_stride, size_t elem_size) {
+    if (in_stride == 1) {
+        std::memcpy(out, in, count * elem_size);
+        return;
     }
-}
 
-void reshape_in3(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    size_t size[3];
-    size_t in_index[3];
-    size_t* map_index[3];
-    for (size_t i = 0; i < 3; i++) {
-        size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
-    }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
-                // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                // clang-format on
-            }
+    in_stride *= elem_size;
+    switch (elem_size) {
+    case 1:
+        copy_strided_row<uint8_t>(in, out, count, in_stride);
+        break;
+    case 2:
+        copy_strided_row<uint16_t>(in, out, count, in_stride);
+        break;
+    case 4:
+        copy_strided_row<uint32_t>(in, out, count, in_stride);
+        break;
+    case 8:
+        copy_strided_row<uint64_t>(in, out, count, in_stride);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(out, in, elem_size);
+            in += in_stride;
+            out += elem_size;
         }
+        break;
     }
 }
 
-void reshape_in4(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    size_t size[4];
-    size_t in_index[4];
-    size_t* map_index[4];
-    for (size_t i = 0; i < 4; i++) {
-        size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
-    }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
-                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
-                    // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                    // clang-format on
-                }
-            }
+// Copies the output row by row, the rows are distributed between threads. The output dimensions which are
+// contiguous in the input as well are merged, so that the rows are as long as possible.
+void transpose_rows(const char* in,
+                    char* out,
+                    const Shape& in_shape,
+                    const AxisVector& in_axis_order,
+                    size_t elem_size) {
+    const auto in_strides = row_major_strides(in_shape);
+    std::vector<size_t> dims;
+    std::vector<size_t> strides;
+    for (const auto axis : in_axis_order) {
+        if (in_shape[axis] == 1)
+            continue;
+        if (!dims.empty() && strides.back() == in_strides[axis] * in_shape[axis]) {
+            dims.back() *= in_shape[axis];
+            strides.back() = in_strides[axis];
+        } else {
+            dims.push_back(in_shape[axis]);
+            strides.push_back(in_strides[axis]);
         }
     }
-}
-
-void reshape_in5(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    size_t size[5];
-    size_t in_index[5];
-    size_t* map_index[5];
-    for (size_t i = 0; i < 5; i++) {
-        size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
+    if (dims.empty()) {
+        std::memcpy(out, in, elem_size);
+        return;
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
-                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
-                    for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4]) {
-                        // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                        // clang-format on
-                    }
-                }
-            }
+
+    const size_t outer_rank = dims.size() - 1;
+    const size_t row_size = dims.back();
+    const size_t row_stride = strides.back();
+    const size_t rows = shape_size(in_shape) / row_size;
+    runtime::reference::parallel_chunks(rows, row_size, [&](size_t begin, size_t end) {
+        std::vector<size_t> index(outer_rank);
+        size_t in_offset = 0;
+        for (size_t i = outer_rank, rest = begin; i-- > 0;) {
+            index[i] = rest % dims[i];
+            rest /= dims[i];
+            in_offset += index[i] * strides[i];
         }
-    }
-}
 
-void reshape_in6(const char* in,
-                 char* out,
-                 const Shape& in_shape,
-                 const AxisVector& in_axis_order,
-                 const Shape& out_shape,
-                 size_t elem_size) {
-    size_t size[6];
-    size_t in_index[6];
-    size_t* map_index[6];
-    for (size_t i = 0; i < 6; i++) {
-        size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
-    }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
-                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
-                    for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4]) {
-                        for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5]) {
-                            // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                            // clang-format on
-                        }
-                    }
-                }
+        for (size_t row = begin; row < end; ++row) {
+            copy_row(in + in_offset * elem_size, out + row * row_size * elem_size, row_size, row_stride, elem_size);
+            for (size_t i = outer_rank; i-- > 0;) {
+                in_offset += strides[i];
+                if (++index[i] < dims[i])
+                    break;
+                in_offset -= strides[i] * dims[i];
+                index[i] = 0;
             }
         }
-    }
+    });
 }
+
 bool no_axis_reordering(const AxisVector& axis_order) {
     auto tmp = axis_order;
     std::sort(begin(tmp), end(tmp));
@@ -218,30 +125,8 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
-    switch (in_shape.size()) {
-    case 0:
-        reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 1:
-        reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 2:
-        reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 3:
-        reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 4:
-        reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 5:
-        reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 6:
-        reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    default:
-        reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    }
+    NGRAPH_CHECK(in_axis_order.size() == in_shape.size(), "Axis order must match the rank of the input shape");
+    if (shape_size(in_shape) == 0)
+        return;
+    transpose_rows(in, out, in_shape, in_axis_order, elem_size);
 }
@@ -5,6 +5,7 @@
 #include "ngraph/runtime/reference/convert.hpp"
 
 #include "jit_generator.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -41,6 +42,30 @@ void jit_convert_vec<float16, float>(jit::Generator& gen, const Xbyak::RegExp& s
     gen.vmovups(gen.yword[dst], f32vec);
 }
 
+template <>
+void jit_convert_vec<uint8_t, float>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto u8vec = gen.xmm1;
+    auto i32vec = gen.ymm2;
+    auto fvec = gen.ymm4;
+
+    gen.movq(u8vec, gen.qword[src]);
+    gen.vpmovzxbd(i32vec, u8vec);
+    gen.vcvtdq2ps(fvec, i32vec);
+    gen.vmovups(gen.yword[dst], fvec);
+}
+
+template <>
+void jit_convert_vec<int8_t, float>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto i8vec = gen.xmm1;
+    auto i32vec = gen.ymm2;
+    auto fvec = gen.ymm4;
+
+    gen.movq(i8vec, gen.qword[src]);
+    gen.vpmovsxbd(i32vec, i8vec);
+    gen.vcvtdq2ps(fvec, i32vec);
+    gen.vmovups(gen.yword[dst], fvec);
+}
+
 template <>
 void jit_convert_vec_prepare<float, int8_t>(jit::Generator& gen) {
     auto order = gen.ymm1;
@@ -183,14 +208,17 @@ template <typename TI, typename TO>
 void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO>();
 
-    if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
-    } else {
-        for (size_t i = 0; i < count; ++i) {
-            out[i] = static_cast<TO>(arg[i]);
+    // the elements are converted independently, so every chunk is processed by the kernel with its own tail
+    parallel_chunks(count, 1, [&](size_t begin, size_t end) {
+        if (converter) {
+            jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+            converter(&args);
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = static_cast<TO>(arg[i]);
+            }
         }
-    }
+    });
 }
 }  // namespace
 
@@ -204,6 +232,16 @@ void convert<float16, float>(const float16* arg, float* out, size_t count) {
     convert_impl(arg, out, count);
 }
 
+template <>
+void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count) {
+    convert_impl(arg, out, count);
+}
+
+template <>
+void convert<int8_t, float>(const int8_t* arg, float* out, size_t count) {
+    convert_impl(arg, out, count);
+}
+
 template <>
 void convert<float, int8_t>(const float* arg, int8_t* out, size_t count) {
     convert_impl(arg, out, count);
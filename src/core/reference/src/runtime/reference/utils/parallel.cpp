@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+
+#include "parallel_executor.hpp"
+
+void ngraph::runtime::reference::parallel_chunks(size_t work_amount,
+                                                 size_t item_cost,
+                                                 const std::function<void(size_t, size_t)>& func) {
+    if (work_amount == 0)
+        return;
+
+    const size_t total_cost = work_amount * std::max<size_t>(item_cost, 1);
+    size_t nthr = std::min<size_t>(work_amount, total_cost / ov::threading::min_parallel_work);
+    nthr = std::min<size_t>(nthr, ov::threading::get_max_threads());
+    if (nthr <= 1) {
+        func(0, work_amount);
+        return;
+    }
+
+    ov::threading::parallel_nt(nthr, [&](size_t ithr, size_t team) {
+        size_t begin = 0, end = 0;
+        ov::threading::splitter(work_amount, team, ithr, begin, end);
+        if (begin < end)
+            func(begin, end);
+    });
+}
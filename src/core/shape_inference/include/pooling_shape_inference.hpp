@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <openvino/op/avg_pool.hpp>
+#include <openvino/op/max_pool.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace pooling {
+
+/**
+ * @brief Infers output shape of a pooling operation and resolves its paddings.
+ * Follows ngraph::infer_batched_pooling_forward: the window is applied to the spatial dimensions only,
+ * pads are taken from attributes or calculated for the input shape when auto_pad is SAME_UPPER/SAME_LOWER.
+ *
+ * @param op                                Pooling operation used for error reporting.
+ * @param input_shape                       Data input shape.
+ * @param kernel                            Pooling window.
+ * @param strides                           Window strides, empty means strides equal to 1.
+ * @param dilations                         Window dilations, empty means no dilation.
+ * @param attr_pads_begin                   Pads begin attribute used for explicit padding.
+ * @param attr_pads_end                     Pads end attribute used for explicit padding.
+ * @param auto_pad                          Auto padding type.
+ * @param rounding_type                     Output dimensions rounding type.
+ * @param is_window_all_in_padding_allowed  If false, check window is never entirely in the padding area.
+ * @param pads_begin                        Resolved pads begin.
+ * @param pads_end                          Resolved pads end.
+ * @param output_shape                      Output shape.
+ */
+template <class T>
+void infer_output_shape(const Node* op,
+                        const T& input_shape,
+                        const Shape& kernel,
+                        const Strides& strides,
+                        const Strides& dilations,
+                        const Shape& attr_pads_begin,
+                        const Shape& attr_pads_end,
+                        const PadType auto_pad,
+                        const RoundingType rounding_type,
+                        const bool is_window_all_in_padding_allowed,
+                        CoordinateDiff& pads_begin,
+                        CoordinateDiff& pads_end,
+                        T& output_shape) {
+    const auto& input_rank = input_shape.rank();
+    NODE_VALIDATION_CHECK(op,
+                          input_rank.compatible(3) || input_rank.compatible(4) || input_rank.compatible(5),
+                          "Expected a 3D, 4D or 5D tensor for the input. Got: ",
+                          input_shape);
+    if (input_rank.is_dynamic()) {
+        output_shape = PartialShape::dynamic();
+        return;
+    }
+
+    const auto num_spatial = static_cast<size_t>(input_rank.get_length() - 2);
+    NODE_VALIDATION_CHECK(op,
+                          kernel.size() == num_spatial,
+                          "Expected kernel size to be equal to input size - 2. Got: ",
+                          kernel.size());
+    NODE_VALIDATION_CHECK(op,
+                          strides.empty() || strides.size() == num_spatial,
+                          "Expected strides size to be equal to input size - 2. Got: ",
+                          strides.size());
+    NODE_VALIDATION_CHECK(op,
+                          dilations.empty() || dilations.size() == num_spatial,
+                          "Expected dilations size to be equal to input size - 2. Got: ",
+                          dilations.size());
+
+    pads_begin.assign(num_spatial, 0);
+    pads_end.assign(num_spatial, 0);
+    if (auto_pad == PadType::EXPLICIT || auto_pad == PadType::NOTSET) {
+        NODE_VALIDATION_CHECK(op,
+                              attr_pads_begin.empty() || attr_pads_begin.size() == num_spatial,
+                              "Expected pads_begin size to be equal to input size - 2. Got: ",
+                              attr_pads_begin.size());
+        NODE_VALIDATION_CHECK(op,
+                              attr_pads_end.empty() || attr_pads_end.size() == num_spatial,
+                              "Expected pads_end size to be equal to input size - 2. Got: ",
+                              attr_pads_end.size());
+        std::copy(attr_pads_begin.begin(), attr_pads_begin.end(), pads_begin.begin());
+        std::copy(attr_pads_end.begin(), attr_pads_end.end(), pads_end.begin());
+    }
+
+    output_shape.resize(input_shape.size());
+    output_shape[0] = input_shape[0];
+    output_shape[1] = input_shape[1];
+    NODE_VALIDATION_CHECK(op,
+                          input_shape[0].is_dynamic() || input_shape[0].get_length() > 0,
+                          "Batch size is zero.");
+    NODE_VALIDATION_CHECK(op,
+                          input_shape[1].is_dynamic() || input_shape[1].get_length() > 0,
+                          "Channel count is zero.");
+
+    for (size_t i = 0; i < num_spatial; ++i) {
+        const auto stride = strides.empty() ? int64_t{1} : static_cast<int64_t>(strides[i]);
+        const auto dilation = dilations.empty() ? int64_t{1} : static_cast<int64_t>(dilations[i]);
+        NODE_VALIDATION_CHECK(op, stride > 0, "Window strides (", strides, ") has zero dimension at axis ", i, ".");
+        NODE_VALIDATION_CHECK(op,
+                              dilation > 0,
+                              "Window dilation (",
+                              dilations,
+                              ") has zero dimension at axis ",
+                              i,
+                              ".");
+        const auto window = dilation * (static_cast<int64_t>(kernel[i]) - 1) + 1;
+        NODE_VALIDATION_CHECK(op,
+                              window > 0,
+                              "Window after dilation has dimension less than 1 (dim: ",
+                              window,
+                              ") at axis ",
+                              i,
+                              ".");
+
+        const auto& dim = input_shape[i + 2];
+        if (dim.is_dynamic()) {
+            output_shape[i + 2] = Dimension::dynamic();
+            continue;
+        }
+        const auto data = static_cast<int64_t>(dim.get_length());
+
+        if (auto_pad == PadType::SAME_UPPER || auto_pad == PadType::SAME_LOWER) {
+            const auto output = (data + stride - 1) / stride;
+            const auto padding_needed = std::max(int64_t{0}, (output - 1) * stride + window - data);
+            const auto padding_lhs = padding_needed / 2;
+            const auto padding_rhs = padding_needed - padding_lhs;
+            pads_begin[i] = auto_pad == PadType::SAME_UPPER ? padding_lhs : padding_rhs;
+            pads_end[i] = auto_pad == PadType::SAME_UPPER ? padding_rhs : padding_lhs;
+        }
+
+        NODE_VALIDATION_CHECK(op,
+                              is_window_all_in_padding_allowed || (window > pads_begin[i] && window > pads_end[i]),
+                              "Window after dilation is sometimes entirely in the padding area for axis ",
+                              i,
+                              " (dilated window dimension: ",
+                              window,
+                              ", padding below dimension: ",
+                              pads_begin[i],
+                              ", padding above dimension: ",
+                              pads_end[i],
+                              ") and this is not allowed.");
+
+        const auto data_padded = data + pads_begin[i] + pads_end[i];
+        NODE_VALIDATION_CHECK(op,
+                              data_padded > 0,
+                              "Data shape after padding and dilation has dimension less than 1 (dim: ",
+                              data_padded,
+                              ") at axis ",
+                              i,
+                              ".");
+        NODE_VALIDATION_CHECK(op,
+                              window <= data_padded,
+                              "Window after dilation has dimension (dim: ",
+                              window,
+                              ") larger than the data shape after padding (dim: ",
+                              data_padded,
+                              ") at axis ",
+                              i,
+                              ".");
+
+        const auto range = data_padded - window;
+        output_shape[i + 2] =
+            (rounding_type == RoundingType::CEIL ? (range + stride - 1) / stride : range / stride) + 1;
+    }
+}
+
+}  // namespace pooling
+
+namespace v1 {
+
+template <class T>
+void shape_infer(const MaxPool* op,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    pooling::infer_output_shape(op,
+                                input_shapes[0],
+                                op->get_kernel(),
+                                op->get_strides(),
+                                Strides{},
+                                op->get_pads_begin(),
+                                op->get_pads_end(),
+                                op->get_auto_pad(),
+                                op->get_rounding_type(),
+                                true,
+                                pads_begin,
+                                pads_end,
+                                output_shapes[0]);
+}
+
+template <class T>
+void shape_infer(const AvgPool* op,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    pooling::infer_output_shape(op,
+                                input_shapes[0],
+                                op->get_kernel(),
+                                op->get_strides(),
+                                Strides{},
+                                op->get_pads_begin(),
+                                op->get_pads_end(),
+                                op->get_auto_pad(),
+                                op->get_rounding_type(),
+                                !op->get_exclude_pad(),
+                                pads_begin,
+                                pads_end,
+                                output_shapes[0]);
+}
+
+}  // namespace v1
+
+namespace v8 {
+
+template <class T>
+void shape_infer(const MaxPool* op,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 2);
+    pooling::infer_output_shape(op,
+                                input_shapes[0],
+                                op->get_kernel(),
+                                op->get_strides(),
+                                op->get_dilations(),
+                                op->get_pads_begin(),
+                                op->get_pads_end(),
+                                op->get_auto_pad(),
+                                op->get_rounding_type(),
+                                true,
+                                pads_begin,
+                                pads_end,
+                                output_shapes[0]);
+    // indices output has the same shape as values
+    output_shapes[1] = output_shapes[0];
+}
+
+}  // namespace v8
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,215 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "parallel_executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ov {
+namespace threading {
+namespace {
+
+// set for the threads which run a parallel job, the nested parallel calls are run serially by them
+thread_local bool in_parallel_job = false;
+
+/// Threads of the default executor: they are created once and wait for the next job, the calling thread
+/// takes part in the job as well
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t workers_num) {
+        m_workers.reserve(workers_num);
+        for (size_t i = 0; i < workers_num; i++)
+            m_workers.emplace_back([this] {
+                work();
+            });
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_job_cv.notify_all();
+        for (auto& worker : m_workers)
+            worker.join();
+    }
+
+    /// Returns false if the job can't be run on the pool (it is busy with another job or the call is nested),
+    /// the caller runs it by itself then
+    bool run(size_t nthr, const std::function<void(size_t, size_t)>& func) {
+        if (in_parallel_job)
+            return false;
+        std::unique_lock<std::mutex> run_lock(m_run_mutex, std::try_to_lock);
+        if (!run_lock.owns_lock())
+            return false;
+
+        Job job{func, nthr};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = &job;
+            m_job_id++;
+        }
+        m_job_cv.notify_all();
+        job.execute();
+        {
+            // all the parts are taken, wait for the workers which still run them
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done_cv.wait(lock, [this] {
+                return m_active_workers == 0;
+            });
+            m_job = nullptr;
+        }
+        if (job.error)
+            std::rethrow_exception(job.error);
+        return true;
+    }
+
+private:
+    struct Job {
+        const std::function<void(size_t, size_t)>& func;
+        const size_t nthr;
+        std::atomic<size_t> next{0};
+        std::mutex error_mutex;
+        std::exception_ptr error;
+
+        Job(const std::function<void(size_t, size_t)>& f, size_t n) : func(f), nthr(n) {}
+
+        void execute() {
+            in_parallel_job = true;
+            for (size_t ithr = next++; ithr < nthr; ithr = next++) {
+                try {
+                    func(ithr, nthr);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            in_parallel_job = false;
+        }
+    };
+
+    void work() {
+        size_t last_job_id = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_job_cv.wait(lock, [&] {
+                return m_stop || (m_job && m_job_id != last_job_id);
+            });
+            if (m_stop)
+                return;
+            last_job_id = m_job_id;
+            auto job = m_job;
+            m_active_workers++;
+            lock.unlock();
+            job->execute();
+            lock.lock();
+            if (--m_active_workers == 0)
+                m_done_cv.notify_all();
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_run_mutex;  // one job is run on the pool at a time
+    std::mutex m_mutex;
+    std::condition_variable m_job_cv;
+    std::condition_variable m_done_cv;
+    Job* m_job = nullptr;
+    size_t m_job_id = 0;
+    size_t m_active_workers = 0;
+    bool m_stop = false;
+};
+
+size_t hardware_threads() {
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+ThreadPool& default_pool() {
+    static ThreadPool pool(hardware_threads() - 1);
+    return pool;
+}
+
+ParallelExecutor make_default_executor() {
+    ParallelExecutor executor;
+    executor.get_max_threads = hardware_threads;
+    executor.run = [](size_t nthr, const std::function<void(size_t, size_t)>& func) {
+        if (default_pool().run(nthr, func))
+            return;
+        for (size_t ithr = 0; ithr < nthr; ithr++)
+            func(ithr, nthr);
+    };
+    return executor;
+}
+
+std::mutex& executor_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::shared_ptr<const ParallelExecutor>& executor_instance() {
+    static std::shared_ptr<const ParallelExecutor> executor =
+        std::make_shared<const ParallelExecutor>(make_default_executor());
+    return executor;
+}
+
+std::shared_ptr<const ParallelExecutor> get_executor() {
+    std::lock_guard<std::mutex> lock(executor_mutex());
+    return executor_instance();
+}
+
+}  // namespace
+
+ParallelExecutor set_parallel_executor(ParallelExecutor executor) {
+    if (!executor.get_max_threads || !executor.run)
+        executor = make_default_executor();
+    auto new_executor = std::make_shared<const ParallelExecutor>(std::move(executor));
+
+    std::lock_guard<std::mutex> lock(executor_mutex());
+    std::swap(executor_instance(), new_executor);
+    return *new_executor;
+}
+
+size_t get_max_threads() {
+    return std::max<size_t>(get_executor()->get_max_threads(), 1);
+}
+
+void parallel_nt(size_t nthr, const std::function<void(size_t, size_t)>& func) {
+    if (nthr == 0)
+        return;
+    if (nthr == 1) {
+        func(0, 1);
+        return;
+    }
+    get_executor()->run(nthr, func);
+}
+
+void parallel_for(size_t work_amount, size_t item_cost, const std::function<void(size_t)>& func) {
+    if (work_amount == 0)
+        return;
+    const auto executor = get_executor();
+    const size_t total_cost = work_amount * std::max<size_t>(item_cost, 1);
+    size_t nthr = std::min<size_t>(work_amount, total_cost / min_parallel_work);
+    nthr = std::min<size_t>(nthr, std::max<size_t>(executor->get_max_threads(), 1));
+    const auto run_chunk = [&](size_t ithr, size_t team) {
+        size_t begin = 0, end = 0;
+        splitter(work_amount, team, ithr, begin, end);
+        for (size_t i = begin; i < end; i++)
+            func(i);
+    };
+    if (nthr <= 1) {
+        run_chunk(0, 1);
+        return;
+    }
+    executor->run(nthr, run_chunk);
+}
+
+}  // namespace threading
+}  // namespace ov
@@ -13,6 +13,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "ir_topology.hpp"
 #include "meta_data.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -1008,12 +1009,165 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
     return bestPath;
 }
 
+class TopologyWriter {
+public:
+    // The layers and ports are taken from the xml representation, so the topology matches it exactly
+    TopologyWriter(const pugi::xml_node& net, const std::string& xml_text) {
+        m_header.xml_size = xml_text.size();
+        m_header.xml_hash = ov::ir_topology::hash(xml_text.data(), xml_text.size());
+        add_string("");
+
+        for (const auto& layer : net.child("layers").children("layer")) {
+            ov::ir_topology::Layer record{};
+            record.id = layer.attribute("id").as_ullong();
+            record.name = add_string(layer.attribute("name").value());
+            record.type = add_string(layer.attribute("type").value());
+            record.version = add_string(layer.attribute("version").value());
+            record.first_port = static_cast<uint32_t>(m_ports.size());
+            record.outputs_count = add_ports(layer.child("output"), true);
+            record.inputs_count = add_ports(layer.child("input"), false);
+            record.first_attribute = static_cast<uint32_t>(m_attributes.size());
+            for (const auto& attribute : layer.child("data").attributes()) {
+                m_attributes.push_back({add_string(attribute.name()), add_string(attribute.value())});
+                record.attributes_count++;
+            }
+            record.flags = is_complete(layer) ? ov::ir_topology::complete_layer : 0;
+            m_layers.push_back(record);
+        }
+        for (const auto& edge : net.child("edges").children("edge")) {
+            m_edges.push_back({edge.attribute("from-layer").as_ullong(),
+                               edge.attribute("from-port").as_ullong(),
+                               edge.attribute("to-layer").as_ullong(),
+                               edge.attribute("to-port").as_ullong()});
+        }
+    }
+
+    void write(std::ostream& bin_file, int64_t bin_offset) {
+        using namespace ov::ir_topology;
+        const auto padding = [](size_t size) {
+            return (alignment - size % alignment) % alignment;
+        };
+        // the header is aligned relative to the beginning of the bin file
+        const auto bin_size = static_cast<size_t>(static_cast<int64_t>(bin_file.tellp()) - bin_offset);
+        const std::string header_padding(padding(bin_size), '\0');
+        bin_file.write(header_padding.data(), header_padding.size());
+
+        m_strings.append(padding(m_strings.size()), '\0');
+        m_header.layers_count = m_layers.size();
+        m_header.layers_offset = sizeof(Header);
+        m_header.ports_count = m_ports.size();
+        m_header.ports_offset = m_header.layers_offset + m_layers.size() * sizeof(Layer);
+        m_header.dims_count = m_dims.size();
+        m_header.dims_offset = m_header.ports_offset + m_ports.size() * sizeof(Port);
+        m_header.attributes_count = m_attributes.size();
+        m_header.attributes_offset = m_header.dims_offset + m_dims.size() * sizeof(Dim);
+        m_header.edges_count = m_edges.size();
+        m_header.edges_offset = m_header.attributes_offset + m_attributes.size() * sizeof(Attribute);
+        m_header.strings_size = m_strings.size();
+        m_header.strings_offset = m_header.edges_offset + m_edges.size() * sizeof(Edge);
+
+        Trailer trailer{};
+        trailer.size = m_header.strings_offset + m_header.strings_size;
+        std::memcpy(trailer.magic, magic(), sizeof(trailer.magic));
+
+        bin_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+        bin_file.write(reinterpret_cast<const char*>(m_layers.data()), m_layers.size() * sizeof(Layer));
+        bin_file.write(reinterpret_cast<const char*>(m_ports.data()), m_ports.size() * sizeof(Port));
+        bin_file.write(reinterpret_cast<const char*>(m_dims.data()), m_dims.size() * sizeof(Dim));
+        bin_file.write(reinterpret_cast<const char*>(m_attributes.data()), m_attributes.size() * sizeof(Attribute));
+        bin_file.write(reinterpret_cast<const char*>(m_edges.data()), m_edges.size() * sizeof(Edge));
+        bin_file.write(m_strings.data(), m_strings.size());
+        bin_file.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+    }
+
+private:
+    // The layer is created from the records if it has only the ports and the attributes of the operation
+    static bool is_complete(const pugi::xml_node& layer) {
+        for (const auto& child : layer.children()) {
+            const std::string name = child.name();
+            if (name == "data") {
+                if (child.first_child())
+                    return false;
+            } else if (name == "input" || name == "output") {
+                for (const auto& port : child.children()) {
+                    if (std::string(port.name()) != "port")
+                        return false;
+                    for (const auto& port_child : port.children()) {
+                        if (std::string(port_child.name()) != "dim")
+                            return false;
+                    }
+                }
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t add_string(const char* str) {
+        const auto found = m_string_offsets.find(str);
+        if (found != m_string_offsets.end())
+            return found->second;
+        const auto offset = static_cast<uint32_t>(m_strings.size());
+        m_strings.append(str);
+        m_strings.push_back('\0');
+        m_string_offsets.emplace(str, offset);
+        return offset;
+    }
+
+    uint32_t add_ports(const pugi::xml_node& ports, bool output) {
+        uint32_t count = 0;
+        for (const auto& port : ports.children("port")) {
+            ov::ir_topology::Port record{};
+            record.id = port.attribute("id").as_ullong();
+            record.precision = output ? add_string(port.attribute("precision").value()) : 0;
+            record.names = add_string(port.attribute("names").value());
+            record.first_dim = static_cast<uint32_t>(m_dims.size());
+            for (const auto& dim : port.children("dim")) {
+                m_dims.push_back(dim.text().as_llong());
+                record.dims_count++;
+            }
+            m_ports.push_back(record);
+            count++;
+        }
+        return count;
+    }
+
+    ov::ir_topology::Header m_header{};
+    std::vector<ov::ir_topology::Layer> m_layers;
+    std::vector<ov::ir_topology::Port> m_ports;
+    std::vector<ov::ir_topology::Dim> m_dims;
+    std::vector<ov::ir_topology::Attribute> m_attributes;
+    std::vector<ov::ir_topology::Edge> m_edges;
+    std::string m_strings;
+    std::unordered_map<std::string, uint32_t> m_string_offsets;
+};
+
+// The binary topology flag is kept in the unused high bit of the version, so the layout of Serialize,
+// which is a part of the public API, is not changed
+constexpr uint8_t binary_topology_flag = 0x80;
+
+ov::pass::Serialize::Version add_binary_topology_flag(ov::pass::Serialize::Version version, bool binary_topology) {
+    return binary_topology ? static_cast<ov::pass::Serialize::Version>(static_cast<uint8_t>(version) |
+                                                                        binary_topology_flag)
+                           : version;
+}
+
+ov::pass::Serialize::Version remove_binary_topology_flag(ov::pass::Serialize::Version version) {
+    return static_cast<ov::pass::Serialize::Version>(static_cast<uint8_t>(version) & ~binary_topology_flag);
+}
+
+bool has_binary_topology_flag(ov::pass::Serialize::Version version) {
+    return (static_cast<uint8_t>(version) & binary_topology_flag) != 0;
+}
+
 void serializeFunc(std::ostream& xml_file,
                    std::ostream& bin_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool binary_topology = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1034,11 +1188,21 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
+    const int64_t bin_offset = bin_file.tellp();
     ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
-    xml_doc.save(xml_file);
+    if (binary_topology) {
+        // the topology is bound to the exact xml text
+        std::stringstream xml_text;
+        xml_doc.save(xml_text);
+        const auto text = xml_text.str();
+        TopologyWriter(net_node, text).write(bin_file, bin_offset);
+        xml_file.write(text.data(), text.size());
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1049,8 +1213,10 @@ namespace ov {
 bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f_orig) {
     RUN_ON_FUNCTION_SCOPE(Serialize);
     auto f = ov::clone_model(*f_orig);
+    const auto version = remove_binary_topology_flag(m_version);
+    const bool binary_topology = has_binary_topology_flag(m_version);
     if (m_xmlFile && m_binFile) {
-        serializeFunc(*m_xmlFile, *m_binFile, f, m_version, m_custom_opsets);
+        serializeFunc(*m_xmlFile, *m_binFile, f, version, m_custom_opsets, false, binary_topology);
     } else {
         auto xmlDir = ov::util::get_directory(m_xmlPath);
         if (xmlDir != m_xmlPath)
@@ -1059,12 +1225,12 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f_or
         std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
-        // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        // create xml file, the binary topology is bound to the exact text without newline conversions
+        std::ofstream xml_file(m_xmlPath, binary_topology ? std::ios::out | std::ios::binary : std::ios::out);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets);
+            serializeFunc(xml_file, bin_file, f, version, m_custom_opsets, false, binary_topology);
         } catch (const ngraph::CheckFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1094,7 +1260,18 @@ pass::Serialize::Serialize(std::ostream& xmlFile,
       m_custom_opsets{custom_opsets} {}
 
 pass::Serialize::Serialize(std::ostream& xmlFile, std::ostream& binFile, pass::Serialize::Version version)
-    : pass::Serialize::Serialize(xmlFile, binFile, std::map<std::string, ngraph::OpSet>{}, version) {}
+    : pass::Serialize::Serialize(xmlFile, binFile, version, false) {}
+
+pass::Serialize::Serialize(std::ostream& xmlFile,
+                           std::ostream& binFile,
+                           pass::Serialize::Version version,
+                           bool binary_topology)
+    : m_xmlFile{&xmlFile},
+      m_binFile{&binFile},
+      m_xmlPath{},
+      m_binPath{},
+      m_version{add_binary_topology_flag(version, binary_topology)},
+      m_custom_opsets{} {}
 
 pass::Serialize::Serialize(const std::string& xmlPath,
                            const std::string& binPath,
@@ -1107,8 +1284,21 @@ pass::Serialize::Serialize(const std::string& xmlPath,
       m_version{version},
       m_custom_opsets{custom_opsets} {}
 
-pass::Serialize::Serialize(const std::string& xmlPath, const std::string& binPath, pass::Serialize::Version version)
-    : pass::Serialize::Serialize(xmlPath, binPath, std::map<std::string, ngraph::OpSet>{}, version) {}
+pass::Serialize::Serialize(const std::string& xmlPath,
+                           const std::string& binPath,
+                           pass::Serialize::Version version)
+    : pass::Serialize::Serialize(xmlPath, binPath, version, false) {}
+
+pass::Serialize::Serialize(const std::string& xmlPath,
+                           const std::string& binPath,
+                           pass::Serialize::Version version,
+                           bool binary_topology)
+    : m_xmlFile{nullptr},
+      m_binFile{nullptr},
+      m_xmlPath{valid_xml_path(xmlPath)},
+      m_binPath{provide_bin_path(xmlPath, binPath)},
+      m_version{add_binary_topology_flag(version, binary_topology)},
+      m_custom_opsets{} {}
 OPENVINO_SUPPRESS_DEPRECATED_END
 
 OPENVINO_SUPPRESS_DEPRECATED_START
@@ -297,6 +297,11 @@ PreProcessSteps& PreProcessSteps::resize(ResizeAlgorithm alg) {
     return *this;
 }
 
+PreProcessSteps& PreProcessSteps::resize(ResizeAlgorithm alg, const std::string& target_size_name) {
+    m_impl->add_resize_impl(alg, target_size_name);
+    return *this;
+}
+
 PreProcessSteps& PreProcessSteps::crop(const std::vector<int>& begin, const std::vector<int>& end) {
     m_impl->add_crop_impl(begin, end);
     return *this;
@@ -202,6 +202,24 @@ bool InputInfo::InputInfoImpl::build(const std::shared_ptr<Model>& model,
                     ", input parameter: ",
                     data.m_param->get_friendly_name());
 
+    // Validate everything before the model is changed, so a failed build leaves it untouched
+    auto param_it = std::find(parameters_list.begin(), parameters_list.end(), data.m_param);
+    OPENVINO_ASSERT(param_it != parameters_list.end(),
+                    "Parameter to replace has been replaced by previous steps of preprocessing. Use only one "
+                    "InputInfo for one input parameter");
+    for (const auto& extra_param : context.extra_params()) {
+        if (!std::get<1>(existing_names)) {
+            existing_names = std::make_tuple(get_function_tensor_names(model), true);
+        }
+        for (const auto& name : extra_param->get_default_output().get_tensor().get_names()) {
+            OPENVINO_ASSERT(std::get<0>(existing_names).count(name) == 0,
+                            "Error while trying to create preprocessing input with name '",
+                            name,
+                            "' - name already exists in model");
+            std::get<0>(existing_names).insert(name);
+        }
+    }
+
     // Replace parameter
     for (auto consumer : consumers) {
         if (dynamic_cast<ov::opset8::Result*>(consumer.get_node())) {
@@ -210,15 +228,11 @@ bool InputInfo::InputInfoImpl::build(const std::shared_ptr<Model>& model,
         }
         consumer.replace_source_output(node);
     }
-    {
-        auto param_it = std::find(parameters_list.begin(), parameters_list.end(), data.m_param);
-        OPENVINO_ASSERT(param_it != parameters_list.end(),
-                        "Parameter to replace has been replaced by previous steps of preprocessing. Use only one "
-                        "InputInfo for one input parameter");
-        // Insert list of new parameters to the place of original parameter
-        param_it = parameters_list.erase(param_it);
-        parameters_list.insert(param_it, data.m_new_params.begin(), data.m_new_params.end());
-    }
+    // Insert list of new parameters to the place of original parameter
+    param_it = parameters_list.erase(param_it);
+    parameters_list.insert(param_it, data.m_new_params.begin(), data.m_new_params.end());
+    // Additional inputs created by preprocessing steps go right after the planes of this input
+    parameters_list.insert(param_it, context.extra_params().begin(), context.extra_params().end());
     return need_validate;
 }
 
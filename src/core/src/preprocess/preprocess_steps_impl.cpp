@@ -141,8 +141,51 @@ void PreStepsList::add_convert_impl(const element::Type& type) {
         "convert type (" + type.get_type_name() + ")");
 }
 
-void PreStepsList::add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_width) {
+static std::shared_ptr<Node> create_resize(ResizeAlgorithm alg,
+                                           const std::vector<Output<Node>>& nodes,
+                                           const PreprocessingContext& ctxt,
+                                           const Output<Node>& target_spatial_shape) {
     using InterpolateMode = op::v4::Interpolate::InterpolateMode;
+    OPENVINO_ASSERT(!nodes.empty(), "Internal error: Can't add resize for empty input.");
+    OPENVINO_ASSERT(nodes.size() == 1,
+                    "Can't resize multi-plane input. Suggesting to convert current image to "
+                    "RGB/BGR color format using 'PreProcessSteps::convert_color'");
+    auto to_mode = [](ResizeAlgorithm alg) -> InterpolateMode {
+        switch (alg) {
+        case ResizeAlgorithm::RESIZE_NEAREST:
+            return InterpolateMode::NEAREST;
+        case ResizeAlgorithm::RESIZE_CUBIC:
+            return InterpolateMode::CUBIC;
+        case ResizeAlgorithm::RESIZE_LINEAR:
+        default:
+            return InterpolateMode::LINEAR;
+        }
+    };
+    auto node = nodes.front();
+    auto layout = ctxt.layout();
+    OPENVINO_ASSERT(ov::layout::has_height(layout) && ov::layout::has_width(layout),
+                    "Can't add resize for layout without W/H specified. Use 'set_layout' API to define layout "
+                    "of image data, like `NCHW`");
+    auto node_rank = node.get_partial_shape().rank();
+    OPENVINO_ASSERT(node_rank.is_static(), "Resize operation is not supported for fully dynamic shape");
+
+    auto height_idx = static_cast<int64_t>(get_and_check_height_idx(layout, node.get_partial_shape()));
+    auto width_idx = static_cast<int64_t>(get_and_check_width_idx(layout, node.get_partial_shape()));
+
+    auto scales = op::v0::Constant::create<float>(element::f32, Shape{2}, {1, 1});
+    // In future consider replacing this to set of new OV operations like `getDimByName(node, "H")`
+    // This is to allow specifying layout on 'evaluation' stage
+    auto axes = op::v0::Constant::create<int64_t>(element::i64, Shape{2}, {height_idx, width_idx});
+
+    op::v4::Interpolate::InterpolateAttrs attrs(to_mode(alg),
+                                                op::v4::Interpolate::ShapeCalcMode::SIZES,
+                                                {0, 0},
+                                                {0, 0});
+
+    return std::make_shared<op::v4::Interpolate>(node, target_spatial_shape, scales, axes, attrs);
+}
+
+void PreStepsList::add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_width) {
     std::string name;
     if (dst_width > 0 && dst_height > 0) {
         name = "resize to (" + std::to_string(dst_height) + ", " + std::to_string(dst_width) + ")";
@@ -153,31 +196,6 @@ void PreStepsList::add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_
         [alg, dst_width, dst_height](const std::vector<Output<Node>>& nodes,
                                      const std::shared_ptr<Model>& function,
                                      PreprocessingContext& ctxt) {
-            OPENVINO_ASSERT(!nodes.empty(), "Internal error: Can't add resize for empty input.");
-            OPENVINO_ASSERT(nodes.size() == 1,
-                            "Can't resize multi-plane input. Suggesting to convert current image to "
-                            "RGB/BGR color format using 'PreProcessSteps::convert_color'");
-            auto to_mode = [](ResizeAlgorithm alg) -> InterpolateMode {
-                switch (alg) {
-                case ResizeAlgorithm::RESIZE_NEAREST:
-                    return InterpolateMode::NEAREST;
-                case ResizeAlgorithm::RESIZE_CUBIC:
-                    return InterpolateMode::CUBIC;
-                case ResizeAlgorithm::RESIZE_LINEAR:
-                default:
-                    return InterpolateMode::LINEAR;
-                }
-            };
-            auto node = nodes.front();
-            auto layout = ctxt.layout();
-            OPENVINO_ASSERT(ov::layout::has_height(layout) && ov::layout::has_width(layout),
-                            "Can't add resize for layout without W/H specified. Use 'set_layout' API to define layout "
-                            "of image data, like `NCHW`");
-            auto node_rank = node.get_partial_shape().rank();
-            OPENVINO_ASSERT(node_rank.is_static(), "Resize operation is not supported for fully dynamic shape");
-
-            auto height_idx = static_cast<int64_t>(get_and_check_height_idx(layout, node.get_partial_shape()));
-            auto width_idx = static_cast<int64_t>(get_and_check_width_idx(layout, node.get_partial_shape()));
             if (dst_height < 0 || dst_width < 0) {
                 OPENVINO_ASSERT(ctxt.model_shape().rank().is_static(),
                                 "Resize is not fully specified while target model shape is dynamic");
@@ -187,22 +205,30 @@ void PreStepsList::add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_
 
             auto target_spatial_shape =
                 op::v0::Constant::create<int64_t>(element::i64, Shape{2}, {new_image_height, new_image_width});
-            auto scales = op::v0::Constant::create<float>(element::f32, Shape{2}, {1, 1});
-            // In future consider replacing this to set of new OV operations like `getDimByName(node, "H")`
-            // This is to allow specifying layout on 'evaluation' stage
-            auto axes = op::v0::Constant::create<int64_t>(element::i64, Shape{2}, {height_idx, width_idx});
-
-            op::v4::Interpolate::InterpolateAttrs attrs(to_mode(alg),
-                                                        op::v4::Interpolate::ShapeCalcMode::SIZES,
-                                                        {0, 0},
-                                                        {0, 0});
-
-            auto interp = std::make_shared<op::v4::Interpolate>(node, target_spatial_shape, scales, axes, attrs);
+            auto interp = create_resize(alg, nodes, ctxt, target_spatial_shape);
             return std::make_tuple(std::vector<Output<Node>>{interp}, true);
         },
         name);
 }
 
+void PreStepsList::add_resize_impl(ResizeAlgorithm alg, const std::string& target_size_name) {
+    OPENVINO_ASSERT(!target_size_name.empty(), "Resize: name of target size input shall not be empty");
+    m_actions.emplace_back(
+        [alg, target_size_name](const std::vector<Output<Node>>& nodes,
+                                const std::shared_ptr<Model>& function,
+                                PreprocessingContext& ctxt) {
+            // Target {height, width} is a new model input, so the same model handles any source and
+            // destination resolution without reshape, resize is performed by plugin's Interpolate kernels
+            auto target_spatial_shape = std::make_shared<op::v0::Parameter>(element::i64, Shape{2});
+            target_spatial_shape->set_friendly_name(target_size_name);
+            target_spatial_shape->get_default_output().get_tensor().set_names({target_size_name});
+            auto interp = create_resize(alg, nodes, ctxt, target_spatial_shape);
+            ctxt.extra_params().push_back(target_spatial_shape);
+            return std::make_tuple(std::vector<Output<Node>>{interp}, true);
+        },
+        "resize to runtime size '" + target_size_name + "'");
+}
+
 void PreStepsList::add_crop_impl(const std::vector<int>& begin, const std::vector<int>& end) {
     std::stringstream name_str;
     name_str << "Crop (" << ov::util::vector_to_string(begin) << "," << ov::util::vector_to_string(end) << ")";
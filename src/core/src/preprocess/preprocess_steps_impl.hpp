@@ -13,6 +13,7 @@
 #include "openvino/core/preprocess/color_format.hpp"
 #include "openvino/core/preprocess/postprocess_steps.hpp"
 #include "openvino/core/preprocess/preprocess_steps.hpp"
+#include "openvino/op/parameter.hpp"
 #include "tensor_name_util.hpp"
 
 namespace ov {
@@ -135,10 +136,20 @@ public:
         return m_color_format;
     }
 
+    // Additional model inputs created by preprocessing steps, e.g. runtime target size of 'resize'
+    const ParameterVector& extra_params() const {
+        return m_extra_params;
+    }
+
+    ParameterVector& extra_params() {
+        return m_extra_params;
+    }
+
 private:
     PartialShape m_model_shape;
     Layout m_model_layout;
     ColorFormat m_color_format = ColorFormat::UNDEFINED;
+    ParameterVector m_extra_params;
 };
 
 using InternalPreprocessOp =
@@ -162,6 +173,7 @@ public:
     void add_convert_impl(const element::Type& type);
     void add_crop_impl(const std::vector<int>& begin, const std::vector<int>& end);
     void add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_width);
+    void add_resize_impl(ResizeAlgorithm alg, const std::string& target_size_name);
     void add_convert_layout_impl(const Layout& layout);
     void add_convert_layout_impl(const std::vector<uint64_t>& dims);
     void add_convert_color_impl(const ColorFormat& dst_format);
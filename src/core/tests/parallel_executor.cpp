@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "parallel_executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+using namespace ov::threading;
+
+TEST(parallel_executor, parallel_for_covers_range) {
+    std::vector<std::atomic<int>> visits(1000);
+    for (auto& visit : visits)
+        visit = 0;
+    parallel_for(visits.size(), min_parallel_work, [&](size_t i) {
+        visits[i]++;
+    });
+    for (size_t i = 0; i < visits.size(); i++)
+        ASSERT_EQ(visits[i], 1) << "index " << i;
+}
+
+TEST(parallel_executor, parallel_nt_rethrows) {
+    EXPECT_THROW(parallel_nt(4,
+                             [](size_t ithr, size_t) {
+                                 if (ithr == 2)
+                                     throw std::runtime_error("error");
+                             }),
+                 std::runtime_error);
+}
+
+TEST(parallel_executor, custom_executor_is_used_by_reference_kernels) {
+    std::atomic<size_t> runs{0};
+    ParallelExecutor serial;
+    serial.get_max_threads = [] {
+        return size_t(3);
+    };
+    serial.run = [&](size_t nthr, const std::function<void(size_t, size_t)>& func) {
+        runs++;
+        for (size_t ithr = 0; ithr < nthr; ithr++)
+            func(ithr, nthr);
+    };
+    auto previous = set_parallel_executor(serial);
+    EXPECT_EQ(get_max_threads(), 3);
+
+    const size_t work_amount = 1 << 20;
+    std::vector<int> visits(work_amount, 0);
+    ngraph::runtime::reference::parallel_chunks(work_amount, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            visits[i]++;
+    });
+    set_parallel_executor(previous);
+
+    EXPECT_EQ(runs, 1);
+    for (size_t i = 0; i < visits.size(); i++)
+        ASSERT_EQ(visits[i], 1) << "index " << i;
+}
+
+TEST(parallel_executor, small_work_is_done_in_calling_thread) {
+    std::atomic<size_t> runs{0};
+    ParallelExecutor counting;
+    counting.get_max_threads = [] {
+        return size_t(4);
+    };
+    counting.run = [&](size_t nthr, const std::function<void(size_t, size_t)>& func) {
+        runs++;
+        for (size_t ithr = 0; ithr < nthr; ithr++)
+            func(ithr, nthr);
+    };
+    auto previous = set_parallel_executor(counting);
+
+    const auto caller = std::this_thread::get_id();
+    bool in_caller = true;
+    parallel_for(100, 1, [&](size_t) {
+        in_caller = in_caller && std::this_thread::get_id() == caller;
+    });
+    EXPECT_EQ(runs, 0);
+    EXPECT_TRUE(in_caller);
+
+    parallel_for(100, min_parallel_work, [](size_t) {});
+    set_parallel_executor(previous);
+    EXPECT_EQ(runs, 1);
+}
+
+TEST(parallel_executor, default_executor_reuses_threads) {
+    auto previous = set_parallel_executor({});
+    std::mutex ids_mutex;
+    std::set<std::thread::id> ids;
+    const size_t nthr = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+    for (size_t i = 0; i < 16; i++) {
+        parallel_nt(nthr, [&](size_t, size_t) {
+            std::lock_guard<std::mutex> lock(ids_mutex);
+            ids.insert(std::this_thread::get_id());
+        });
+    }
+    set_parallel_executor(previous);
+    // a thread per call would give a new id on every call
+    EXPECT_LE(ids.size(), nthr);
+}
+
+TEST(parallel_executor, default_executor_runs_nested_calls) {
+    auto previous = set_parallel_executor({});
+    const size_t nthr = 4;
+    std::vector<std::atomic<int>> visits(nthr * nthr);
+    for (auto& visit : visits)
+        visit = 0;
+    parallel_nt(nthr, [&](size_t ithr, size_t) {
+        parallel_nt(nthr, [&](size_t jthr, size_t) {
+            visits[ithr * nthr + jthr]++;
+        });
+    });
+    set_parallel_executor(previous);
+    for (size_t i = 0; i < visits.size(); i++)
+        ASSERT_EQ(visits[i], 1) << "index " << i;
+}
@@ -70,6 +70,20 @@ TEST_P(SerializationTest, SerializeHelper) {
     });
 }
 
+TEST_P(SerializationTest, BinaryTopology) {
+    CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
+        ov::pass::Serialize(m_out_xml_path, m_out_bin_path, ov::pass::Serialize::Version::UNSPECIFIED, true)
+            .run_on_model(m);
+
+        // the topology section ends with the magic
+        std::ifstream bin(m_out_bin_path, std::ios::binary);
+        bin.seekg(-8, std::ios::end);
+        std::string magic(8, '\0');
+        bin.read(&magic[0], magic.size());
+        EXPECT_EQ(magic, "OVTOPO02");
+    });
+}
+
 INSTANTIATE_TEST_SUITE_P(
     IRSerialization,
     SerializationTest,
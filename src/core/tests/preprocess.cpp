@@ -787,6 +787,49 @@ TEST(pre_post_process, resize_no_model_layout) {
     EXPECT_NO_THROW(p.build());
 }
 
+TEST(pre_post_process, resize_runtime_size_dynamic_model) {
+    auto f = create_simple_function(element::f32, PartialShape{1, 3, -1, -1});
+    auto p = PrePostProcessor(f);
+    p.input().tensor().set_spatial_dynamic_shape().set_layout("NHWC");
+    p.input().preprocess().resize(ResizeAlgorithm::RESIZE_LINEAR, "target_size");
+    p.input().model().set_layout("NCHW");
+    p.build();
+    ASSERT_EQ(f->get_parameters().size(), 2);
+    EXPECT_EQ(f->input(0).get_partial_shape(), (PartialShape{1, -1, -1, 3}));
+    EXPECT_EQ(f->input(1).get_element_type(), element::i64);
+    EXPECT_EQ(f->input(1).get_partial_shape(), (PartialShape{2}));
+    EXPECT_EQ(f->input(1).get_tensor().get_names(), std::unordered_set<std::string>{"target_size"});
+    EXPECT_EQ(f->output().get_partial_shape(), (PartialShape{1, 3, -1, -1}));
+}
+
+TEST(pre_post_process, resize_runtime_size_keeps_inputs_order) {
+    auto f = create_n_inputs<2>(element::f32, Shape{1, 3, 224, 224});
+    auto p = PrePostProcessor(f);
+    p.input(0).tensor().set_spatial_dynamic_shape().set_layout("NCHW");
+    p.input(0).preprocess().resize(ResizeAlgorithm::RESIZE_NEAREST, "size0");
+    p.build();
+    ASSERT_EQ(f->get_parameters().size(), 3);
+    EXPECT_EQ(f->input(0).get_partial_shape(), (PartialShape{1, 3, -1, -1}));
+    EXPECT_EQ(f->input(1).get_tensor().get_names(), std::unordered_set<std::string>{"size0"});
+    EXPECT_EQ(f->input(2).get_partial_shape(), (PartialShape{1, 3, 224, 224}));
+}
+
+TEST(pre_post_process, resize_runtime_size_name_exists) {
+    auto f = create_simple_function(element::f32, PartialShape{1, 3, -1, -1});
+    auto p = PrePostProcessor(f);
+    p.input().tensor().set_layout("NCHW");
+    p.input().preprocess().resize(ResizeAlgorithm::RESIZE_LINEAR, "tensor_input1");
+    const auto param = f->get_parameters().front();
+    const auto consumers = param->output(0).get_target_inputs();
+    const auto ops_num = f->get_ordered_ops().size();
+    EXPECT_THROW(p.build(), ov::AssertFailure);
+    // The name clash is detected before the model is changed
+    ASSERT_EQ(f->get_parameters().size(), 1);
+    EXPECT_EQ(f->get_parameters().front(), param);
+    EXPECT_EQ(param->output(0).get_target_inputs(), consumers);
+    EXPECT_EQ(f->get_ordered_ops().size(), ops_num);
+}
+
 // Error cases for 'resize'
 TEST(pre_post_process, tensor_spatial_shape_no_layout_dims) {
     auto f = create_simple_function(element::f32, Shape{1, 3, 224, 224});
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <numeric>
 #include <vector>
 
@@ -220,3 +221,37 @@ INSTANTIATE_TEST_SUITE_P(reshape_opt_kernel_ref_impl_fallback,
                                                           {11, 21, 13, 23, 15, 25},
                                                           {12, 22, 14, 24, 16, 26},
                                                       }}));
+
+TEST(reshape_opt_kernel, transpose_large_all_element_sizes) {
+    // the shape is large enough to be split between threads, the dimensions 1 and 2 are contiguous in the output
+    const Shape in_shape{3, 17, 5, 64, 9};
+    const AxisVector axis_order{4, 1, 2, 0, 3};
+    Shape out_shape(in_shape.size());
+    for (size_t i = 0; i < axis_order.size(); i++)
+        out_shape[i] = in_shape[axis_order[i]];
+    const auto in_strides = row_major_strides(in_shape);
+    const size_t count = shape_size(in_shape);
+
+    for (const size_t elem_size : {1, 2, 3, 4, 8}) {
+        std::vector<char> input(count * elem_size);
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = static_cast<char>(i * 7 + i / 251);
+        std::vector<char> output(input.size());
+
+        runtime::opt_kernel::reshape(input.data(), output.data(), in_shape, axis_order, out_shape, elem_size);
+
+        std::vector<size_t> out_index(out_shape.size(), 0);
+        for (size_t out_offset = 0; out_offset < count; out_offset++) {
+            size_t in_offset = 0;
+            for (size_t i = 0; i < out_index.size(); i++)
+                in_offset += out_index[i] * in_strides[axis_order[i]];
+            ASSERT_EQ(0, std::memcmp(&output[out_offset * elem_size], &input[in_offset * elem_size], elem_size))
+                << "element size " << elem_size << ", offset " << out_offset;
+            for (size_t i = out_index.size(); i-- > 0;) {
+                if (++out_index[i] < out_shape[i])
+                    break;
+                out_index[i] = 0;
+            }
+        }
+    }
+}
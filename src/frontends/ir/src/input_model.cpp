@@ -194,6 +194,8 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> m_extensions;
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
+    // the layers of the model are parsed into the DOM one by one during the conversion
+    ov::XmlLayersStream m_layers;
     pugi::xml_document m_xml_doc;
 
 public:
@@ -202,11 +204,14 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
+        pugi::xml_parse_result res = m_layers.load(stream, m_xml_doc);
         if (res.status != pugi::status_ok) {
             IE_THROW() << res.description() << " at offset " << res.offset;
         }
         m_root = m_xml_doc.document_element();
+        // the topology written by ov::pass::Serialize at the end of the weights, if any
+        if (m_weights)
+            m_layers.set_topology(ov::ir_topology::find(m_weights->get_ptr<char>(), m_weights->size()));
         for (const auto& it : ov::get_available_opsets()) {
             m_opsets[it.first] = it.second();
         }
@@ -230,7 +235,7 @@ std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
 
     // Load default opsets
     size_t version = XMLParseUtils::GetUIntAttr(m_root, "version", 0);
-    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version, &m_layers);
     std::shared_ptr<ngraph::Function> function;
     visitor.on_attribute("net", function);
     function->get_rt_info()["version"] = int64_t(version);
@@ -395,48 +395,107 @@ void XmlDeserializer::on_adapter(const std::string& name,
         }
         ngraph_function = parse_function(m_node.child(name.c_str()), m_weights);
     } else if (!name.compare("net")) {
-        ngraph_function = parse_function(m_node, m_weights);
+        ngraph_function = m_layers_stream && m_layers_stream->is_split()
+                              ? parse_function_from_stream(m_node, m_weights)
+                              : parse_function(m_node, m_weights);
     } else {
         IE_THROW() << "Error: not recognized adapter name: " << name << ".";
     }
     adapter.set(ngraph_function);
 }
 
+ngraph::OutputVector XmlDeserializer::get_layer_inputs(
+    const GenericLayerParams& params,
+    const std::vector<LayerEdge>& edges,
+    const std::unordered_map<size_t, GenericLayerParams>& layers_params,
+    const std::unordered_map<size_t, std::shared_ptr<ngraph::Node>>& id_to_node) {
+    ngraph::OutputVector inputs(edges.size());
+    for (auto& e : edges) {
+        const auto input_node = id_to_node.find(e.fromLayerId);
+        if (input_node == id_to_node.end() || !input_node->second) {
+            IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+        }
+        auto& p_output = layers_params.at(e.fromLayerId);
+        size_t const realInputPortId = params.getRealInputPortId(e.toPortId);
+        if (realInputPortId >= inputs.size())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " is inconsistent!";
+        inputs[realInputPortId] = input_node->second->output(p_output.getRealOutputPortId(e.fromPortId));
+    }
+    return inputs;
+}
+
+void XmlDeserializer::add_function_node(size_t layer_id,
+                                        const std::shared_ptr<ngraph::Node>& node,
+                                        FunctionNodes& func_nodes) {
+    if (const auto& parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
+        io_map.inputs.insert({layer_id, func_nodes.parameters.size()});
+        func_nodes.parameters.emplace_back(parameter_node);
+    }
+
+    if (const auto& result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
+        io_map.outputs.insert({layer_id, func_nodes.results.size()});
+        func_nodes.results.emplace_back(result_node);
+    }
+
+    if (const auto& sink = std::dynamic_pointer_cast<ngraph::op::Sink>(node)) {
+        func_nodes.sinks.emplace_back(sink);
+    }
+
+    if (const auto& read_value = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(node)) {
+        func_nodes.variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+    }
+}
+
+std::shared_ptr<ngraph::Function> XmlDeserializer::create_function(const pugi::xml_node& root,
+                                                                   const FunctionNodes& func_nodes) {
+    // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphFunction");
+
+    auto function = std::make_shared<ngraph::Function>(func_nodes.results,
+                                                       func_nodes.sinks,
+                                                       func_nodes.parameters,
+                                                       XMLParseUtils::GetStrAttr(root, "name", ""));
+    for (const auto& sink : func_nodes.sinks) {
+        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink)) {
+            assign->add_control_dependency(func_nodes.variable_id_to_read_value.at(assign->get_variable_id()));
+        }
+    }
+
+    // Read meta data from legacy representation
+    if (root.child("rt_info").empty()) {
+        // Legacy representation
+        // meta_data - MO meta
+        // quantization_parameters - NNCF quantization section
+        std::unordered_set<std::string> meta_names = {"meta_data", "quantization_parameters"};
+        read_legacy_meta_data(function, meta_names, root);
+    } else {
+        read_meta_data(function, root.child("rt_info"));
+    }
+
+    return function;
+}
+
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root,
     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
     // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
-    struct FunctionNodes {
-        ngraph::ParameterVector parameters;
-        ngraph::ResultVector results;
-        ngraph::NodeVector all;
-        ngraph::SinkVector sinks;
-    };
-
-    struct edge {
-        size_t fromLayerId, fromPortId, toPortId;
-    };
-    struct node_params {
-        pugi::xml_node xml;
-        GenericLayerParams params;
-    };
-
-    std::map<size_t /*layer-id*/, node_params> params;
+    std::unordered_map<size_t /*layer-id*/, pugi::xml_node> layers_xml;
+    std::unordered_map<size_t /*layer-id*/, GenericLayerParams> layers_params;
 
     std::vector<size_t /*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    std::map<size_t /*to-layer-id*/, std::vector<LayerEdge>> edges;
     // Read all layers and store their parameters in params map
     FOREACH_CHILD (node, root.child("layers"), "layer") {
         auto node_param = parseGenericParams(node);
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        layers_xml[node_param.layerId] = node;
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -447,6 +506,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+        layers_params[node_param.layerId] = std::move(node_param);
     }
 
     // Read all edges and store them for further usage
@@ -473,89 +533,204 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
-    std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
 
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
-        auto& p = params[layer_id];
+        auto& p = layers_params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
-        ngraph::OutputVector inputs(edgeIt->second.size());
-        for (auto& e : edgeIt->second) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
-            }
-            auto& p_output = params[e.fromLayerId].params;
-            size_t const realInputPortId = p.params.getRealInputPortId(e.toPortId);
-            if (realInputPortId >= inputs.size())
-                IE_THROW() << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
-                           << " is inconsistent!";
-            inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
+        const auto inputs = get_layer_inputs(p, edgeIt->second, layers_params, id_to_node);
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        auto node = createNode(inputs, layers_xml[layer_id], weights, p);
         id_to_node[layer_id] = node;
 
         // Check that output shape after OpenVINO node validation the same as in IR
         // because IR always right!
         // Temporary disabled!
-        //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
-        //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
+        //        for (size_t i = 0; i < p.outputPorts.size(); ++i) {
+        //            if (p.outputPorts[i].dims != node->output(i).get_shape()) {
         //                IE_THROW() << "Shape after Model infer " <<
         //                details::dumpVec(node->output(i).get_shape())
         //                                   << " differ from IR shapes: " <<
-        //                                   details::dumpVec(p.params.outputPorts[i].dims);
+        //                                   details::dumpVec(p.outputPorts[i].dims);
         //            }
         //        }
 
-        if (const auto& parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
-            io_map.inputs.insert({layer_id, func_nodes.parameters.size()});
-            func_nodes.parameters.emplace_back(parameter_node);
-        }
+        add_function_node(layer_id, node, func_nodes);
+    }
+
+    return create_function(root, func_nodes);
+}
 
-        if (const auto& result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
-            io_map.outputs.insert({layer_id, func_nodes.results.size()});
-            func_nodes.results.emplace_back(result_node);
+std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function_from_stream(
+    const pugi::xml_node& root,
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
+    // The layers are created in the order of the stream, so only a single layer is parsed into the DOM at a time.
+    // A layer which goes before its producers waits for them and is parsed again once they are created.
+    // If the binary topology is attached, the generic parameters, the edges and the attributes of the operations
+    // are taken from it, only the layers with other content (sub-graphs, runtime info) are parsed from the xml.
+    // As in parse_function, only the Parameters and the layers the outputs
+    // (Result, Assign) depend on are created, so the dead layers are never parsed.
+    const auto topology = m_layers_stream->get_topology();
+    std::unordered_map<size_t /*to-layer-id*/, std::vector<LayerEdge>> edges;
+    if (topology) {
+        const auto topology_edges = ir_topology::records<ir_topology::Edge>(topology, topology->edges_offset);
+        for (size_t i = 0; i < topology->edges_count; ++i) {
+            const auto& e = topology_edges[i];
+            edges[e.to_layer].push_back({e.from_layer, e.from_port, e.to_port});
+        }
+    } else {
+        FOREACH_CHILD (_ec, root.child("edges"), "edge") {
+            size_t fromLayer = XMLParseUtils::GetUIntAttr(_ec, "from-layer");
+            size_t fromPort = XMLParseUtils::GetUIntAttr(_ec, "from-port");
+            size_t toLayer = XMLParseUtils::GetUIntAttr(_ec, "to-layer");
+            size_t toPort = XMLParseUtils::GetUIntAttr(_ec, "to-port");
+            edges[toLayer].push_back({fromLayer, fromPort, toPort});
         }
+    }
 
-        if (const auto& sink = std::dynamic_pointer_cast<ngraph::op::Sink>(node)) {
-            func_nodes.sinks.emplace_back(sink);
+    std::unordered_map<size_t /*layer-id*/, GenericLayerParams> layers_params;
+    std::unordered_map<size_t /*layer-id*/, size_t /*stream index*/> layers_index;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+
+    // Read the headers of all the layers to find the ones reachable from the outputs
+    std::vector<size_t /*layer-id*/> stream_ids(m_layers_stream->size());
+    std::unordered_set<size_t /*layer-id*/> used_layers;
+    {
+        std::unordered_set<std::string> opName;
+        std::vector<size_t /*layer-id*/> dfs_stack;
+        pugi::xml_document header_doc;
+        for (size_t i = 0; i < m_layers_stream->size(); ++i) {
+            size_t layer_id;
+            std::string type, name;
+            if (topology) {
+                const auto strings = ir_topology::records<char>(topology, topology->strings_offset);
+                const auto& layer = ir_topology::records<ir_topology::Layer>(topology, topology->layers_offset)[i];
+                layer_id = layer.id;
+                type = strings + layer.type;
+                name = strings + layer.name;
+            } else {
+                const auto header = m_layers_stream->parse_layer_header(i, header_doc);
+                layer_id = XMLParseUtils::GetUIntAttr(header, "id");
+                type = XMLParseUtils::GetStrAttr(header, "type");
+                name = XMLParseUtils::GetStrAttr(header, "name");
+            }
+            if (opName.find(name) != opName.end() && type != "Result")
+                IE_THROW() << "Invalid IR! " << name << " name is not unique!";
+            opName.insert(name);
+            stream_ids[i] = layer_id;
+            if (type == "Parameter") {
+                used_layers.insert(layer_id);
+            } else if (type == "Result" || type == "Assign") {
+                dfs_stack.push_back(layer_id);
+            }
         }
+        while (!dfs_stack.empty()) {
+            const size_t id = dfs_stack.back();
+            dfs_stack.pop_back();
+            if (!used_layers.insert(id).second)
+                continue;
+            const auto edgeIt = edges.find(id);
+            if (edgeIt == edges.end())
+                continue;
+            for (const auto& edge : edgeIt->second)
+                dfs_stack.push_back(edge.fromLayerId);
+        }
+    }
 
-        if (const auto& read_value = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(node)) {
-            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+    std::unordered_map<size_t /*layer-id*/, size_t> missing_inputs;
+    std::unordered_map<size_t /*from-layer-id*/, std::vector<size_t /*to-layer-id*/>> waiting_layers;
+
+    FunctionNodes func_nodes;
+    // Results and sinks keep the order of the stream regardless of the order of creation
+    std::map<size_t /*stream index*/, std::pair<size_t /*layer-id*/, std::shared_ptr<ngraph::Node>>> outputs;
+
+    const auto create_layer = [&](size_t layer_id, const pugi::xml_node& node) {
+        const auto& p = layers_params.at(layer_id);
+        ngraph::OutputVector inputs;
+        if (p.type != "Parameter")
+            inputs = get_layer_inputs(p, edges[layer_id], layers_params, id_to_node);
+
+        auto ngraph_node = createNode(inputs, node, weights, p);
+        id_to_node[layer_id] = ngraph_node;
+        if (std::dynamic_pointer_cast<ngraph::op::Result>(ngraph_node) ||
+            std::dynamic_pointer_cast<ngraph::op::Sink>(ngraph_node)) {
+            outputs[layers_index.at(layer_id)] = {layer_id, ngraph_node};
+        } else {
+            add_function_node(layer_id, ngraph_node, func_nodes);
         }
+    };
 
-        func_nodes.all.emplace_back(node);
-    }
+    pugi::xml_document layer_doc;
+    pugi::xml_document waiting_doc;
+    for (size_t i = 0; i < m_layers_stream->size(); ++i) {
+        if (!used_layers.count(stream_ids[i]))
+            continue;
 
-    // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphFunction");
+        pugi::xml_node node;
+        GenericLayerParams node_param;
+        if (topology) {
+            node_param = parseGenericParams(*topology, i);
+        } else {
+            node = m_layers_stream->parse_layer(i, layer_doc);
+            node_param = parseGenericParams(node);
+        }
 
-    auto function = std::make_shared<ngraph::Function>(func_nodes.results,
-                                                       func_nodes.sinks,
-                                                       func_nodes.parameters,
-                                                       XMLParseUtils::GetStrAttr(root, "name", ""));
-    for (const auto& sink : func_nodes.sinks) {
-        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink)) {
-            assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
+        const size_t layer_id = node_param.layerId;
+        size_t missing = 0;
+        if (node_param.type != "Parameter") {
+            for (const auto& e : edges[layer_id]) {
+                if (!id_to_node.count(e.fromLayerId)) {
+                    waiting_layers[e.fromLayerId].push_back(layer_id);
+                    ++missing;
+                }
+            }
+        }
+        layers_params[layer_id] = std::move(node_param);
+        layers_index[layer_id] = i;
+        if (missing) {
+            missing_inputs[layer_id] = missing;
+            continue;
+        }
+
+        create_layer(layer_id, node ? node : m_layers_stream->load_layer(i, layer_doc));
+
+        // create the waiting layers which are ready now
+        std::vector<size_t> created{layer_id};
+        while (!created.empty()) {
+            const size_t producer = created.back();
+            created.pop_back();
+            const auto waiting = waiting_layers.find(producer);
+            if (waiting == waiting_layers.end())
+                continue;
+            for (const auto consumer : waiting->second) {
+                if (--missing_inputs.at(consumer))
+                    continue;
+                missing_inputs.erase(consumer);
+                create_layer(consumer, m_layers_stream->load_layer(layers_index.at(consumer), waiting_doc));
+                created.push_back(consumer);
+            }
+            waiting_layers.erase(waiting);
         }
     }
 
-    // Read meta data from legacy representation
-    if (root.child("rt_info").empty()) {
-        // Legacy representation
-        // meta_data - MO meta
-        // quantization_parameters - NNCF quantization section
-        std::unordered_set<std::string> meta_names = {"meta_data", "quantization_parameters"};
-        read_legacy_meta_data(function, meta_names, root);
-    } else {
-        read_meta_data(function, root.child("rt_info"));
+    // the layers which are still waiting are skipped unless the outputs depend on them
+    for (const auto& waiting : missing_inputs) {
+        const auto& p = layers_params.at(waiting.first);
+        if (p.type != "Result" && p.type != "Assign")
+            continue;
+        for (const auto& e : edges[waiting.first]) {
+            if (!id_to_node.count(e.fromLayerId))
+                IE_THROW() << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+        }
     }
 
-    return function;
+    for (const auto& output : outputs)
+        add_function_node(output.second.first, output.second.second, func_nodes);
+
+    return create_function(root, func_nodes);
 }
 
 class MetaDataParser : public ov::Meta {
@@ -675,6 +850,61 @@ void XmlDeserializer::read_legacy_meta_data(const std::shared_ptr<ov::Model>& mo
         read_meta(model, it, root_section.child(it.c_str()));
 }
 
+std::unordered_set<std::string> XmlDeserializer::restore_port_names(const std::vector<std::string>& names) {
+    std::unordered_set<std::string> result;
+    for (size_t i = 0; i < names.size(); i++) {
+        std::string name = names[i];
+        // Restore original name if it contains delimiter
+        // getParameters(...) returns the vector of names which were split by delimiter ','
+        // but some names can contain ',' as a part of name, in this case we use '\' to
+        // escape delimiter the cycle below is needed in order to find names which contained
+        // delimiter and restore the original name
+        while (i < names.size() && names[i].at(names[i].length() - 1) == '\\') {
+            name.replace(names[i].length() - 1, 1, ",");
+            name += names[++i];
+        }
+        result.emplace(name);
+    }
+    return result;
+}
+
+GenericLayerParams XmlDeserializer::parseGenericParams(const ir_topology::Header& topology, size_t index) {
+    const auto strings = ir_topology::records<char>(&topology, topology.strings_offset);
+    const auto& layer = ir_topology::records<ir_topology::Layer>(&topology, topology.layers_offset)[index];
+    const auto ports = ir_topology::records<ir_topology::Port>(&topology, topology.ports_offset);
+    const auto dims = ir_topology::records<ir_topology::Dim>(&topology, topology.dims_offset);
+
+    GenericLayerParams params;
+    params.layerId = layer.id;
+    params.version = strings + layer.version;
+    params.type = strings + layer.type;
+    params.name = strings + layer.name;
+
+    const auto parsePort = [&](const ir_topology::Port& record, bool input) -> GenericLayerParams::LayerPortData {
+        GenericLayerParams::LayerPortData port;
+        port.portId = record.id;
+        for (uint32_t i = 0; i < record.dims_count; i++) {
+            const auto dim = dims[record.first_dim + i];
+            if (dim < -1) {
+                IE_THROW() << "dimension (" << dim << ") in layer " << params.name << " must be greater or equal to -1";
+            }
+            port.dims.emplace_back(dim);
+        }
+        // Input port hasn't precision
+        port.precision = input ? ngraph::element::Type_t::undefined
+                               : InferenceEngine::details::convertPrecision(strings + record.precision);
+        std::vector<std::string> names;
+        str_to_container(strings + record.names, names);
+        port.names = restore_port_names(names);
+        return port;
+    };
+    for (uint32_t i = 0; i < layer.outputs_count; i++)
+        params.outputPorts.emplace_back(parsePort(ports[layer.first_port + i], false));
+    for (uint32_t i = 0; i < layer.inputs_count; i++)
+        params.inputPorts.emplace_back(parsePort(ports[layer.first_port + layer.outputs_count + i], true));
+    return params;
+}
+
 GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& node) {
     const auto parsePort = [this](const pugi::xml_node& parentNode,
                                   const GenericLayerParams& params,
@@ -703,19 +933,7 @@ GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& nod
         port.precision = type;
         std::vector<std::string> names;
         if (getParameters<std::string>(parentNode, "names", names)) {
-            for (size_t i = 0; i < names.size(); i++) {
-                std::string name = names[i];
-                // Restore original name if it contains delimiter
-                // getParameters(...) returns the vector of names which were split by delimiter ','
-                // but some names can contain ',' as a part of name, in this case we use '\' to
-                // escape delimiter the cycle below is needed in order to find names which contained
-                // delimiter and restore the original name
-                while (i < names.size() && names[i].at(names[i].length() - 1) == '\\') {
-                    name.replace(names[i].length() - 1, 1, ",");
-                    name += names[++i];
-                }
-                port.names.emplace(name);
-            }
+            port.names = restore_port_names(names);
         }
         return port;
     };
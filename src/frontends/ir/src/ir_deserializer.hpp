@@ -17,6 +17,7 @@
 #include "openvino/op/loop.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
 #include "utils.hpp"
+#include "xml_layers_stream.hpp"
 #include "xml_parse_utils.h"
 
 namespace ov {
@@ -65,13 +66,15 @@ public:
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
-                             size_t version)
+                             size_t version,
+                             const XmlLayersStream* layers_stream = nullptr)
         : m_node(node),
           m_weights(weights),
           m_opsets(opsets),
           m_extensions(extensions),
           m_variables(variables),
-          m_version(version) {}
+          m_version(version),
+          m_layers_stream(layers_stream) {}
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
         std::string val;
@@ -148,6 +151,17 @@ private:
         NodeIdToIoIndex outputs;
     };
 
+    struct LayerEdge {
+        size_t fromLayerId, fromPortId, toPortId;
+    };
+
+    struct FunctionNodes {
+        ov::ParameterVector parameters;
+        ov::ResultVector results;
+        ov::SinkVector sinks;
+        std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+    };
+
     /// \brief Traverses port_map in order to create vector of InputDescription shared_ptrs.
     /// Shall be used only for ops which have port_map attribute.
     /// \param node xml op representation
@@ -168,12 +182,28 @@ private:
     /// \return shared pointer to function representing input node
     std::shared_ptr<ov::Model> parse_function(const pugi::xml_node& root,
                                               const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights);
+    /// \brief Creates ov function for the top-level model whose layers are parsed one by one from the layers stream.
+    /// \param root xml node representation without layers
+    /// \param weights weights attached to current node
+    /// \return shared pointer to function representing input node
+    std::shared_ptr<ov::Model> parse_function_from_stream(
+        const pugi::xml_node& root,
+        const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights);
+
+    ov::OutputVector get_layer_inputs(const GenericLayerParams& params,
+                                      const std::vector<LayerEdge>& edges,
+                                      const std::unordered_map<size_t, GenericLayerParams>& layers_params,
+                                      const std::unordered_map<size_t, std::shared_ptr<ov::Node>>& id_to_node);
+    void add_function_node(size_t layer_id, const std::shared_ptr<ov::Node>& node, FunctionNodes& func_nodes);
+    std::shared_ptr<ov::Model> create_function(const pugi::xml_node& root, const FunctionNodes& func_nodes);
     /// \brief Traverses xml node representation in order to get the purpose attribute of
     /// inputs/outputs in the body of Loop op. \param node xml node representation \return struct
     /// with value of purpuse attribute
     ov::op::v5::Loop::SpecialBodyPorts parsePurposeAttribute(const pugi::xml_node& node);
 
     GenericLayerParams parseGenericParams(const pugi::xml_node& node);
+    GenericLayerParams parseGenericParams(const ir_topology::Header& topology, size_t index);
+    static std::unordered_set<std::string> restore_port_names(const std::vector<std::string>& names);
 
     std::shared_ptr<ov::Node> createNode(const ov::OutputVector& inputs,
                                          const pugi::xml_node& node,
@@ -200,5 +230,8 @@ private:
     IoMap io_map;
 
     int64_t m_version;
+
+    // layers of the top-level model if they are not parsed into the DOM of m_node
+    const XmlLayersStream* m_layers_stream;
 };
 }  // namespace ov
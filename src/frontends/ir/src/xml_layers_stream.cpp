@@ -0,0 +1,230 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "xml_layers_stream.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+#include "ie_common.h"
+
+namespace ov {
+namespace {
+
+enum class TagKind { open, close, self_closing, other };
+
+struct Tag {
+    size_t begin;
+    size_t end;
+    TagKind kind;
+    std::string name;
+};
+
+// Finds the markup following the position: element tags, comments, CDATA sections, processing instructions, etc.
+// The text outside of the markup can't contain '<', while the quoted attribute values can contain '>'.
+bool next_tag(const std::string& text, size_t pos, Tag& tag) {
+    tag.begin = text.find('<', pos);
+    if (tag.begin == std::string::npos)
+        return false;
+
+    const auto skip_to = [&](const char* terminator) {
+        const auto found = text.find(terminator, tag.begin + 1);
+        if (found == std::string::npos)
+            return false;
+        tag.end = found + std::strlen(terminator);
+        tag.kind = TagKind::other;
+        return true;
+    };
+    if (text.compare(tag.begin, 4, "<!--") == 0)
+        return skip_to("-->");
+    if (text.compare(tag.begin, 9, "<![CDATA[") == 0)
+        return skip_to("]]>");
+    if (text.compare(tag.begin, 2, "<?") == 0)
+        return skip_to("?>");
+    if (text.compare(tag.begin, 2, "<!") == 0)
+        return skip_to(">");
+
+    const bool closing = text.compare(tag.begin, 2, "</") == 0;
+    const size_t name_begin = tag.begin + (closing ? 2 : 1);
+    size_t i = name_begin;
+    while (i < text.size() && !std::isspace(static_cast<unsigned char>(text[i])) && text[i] != '>' && text[i] != '/')
+        ++i;
+    tag.name = text.substr(name_begin, i - name_begin);
+
+    char quote = 0;
+    for (; i < text.size(); ++i) {
+        const char c = text[i];
+        if (quote) {
+            if (c == quote)
+                quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '>') {
+            break;
+        }
+    }
+    if (i == text.size())
+        return false;
+
+    tag.end = i + 1;
+    tag.kind = closing ? TagKind::close : (text[i - 1] == '/' ? TagKind::self_closing : TagKind::open);
+    return true;
+}
+
+}  // namespace
+
+bool XmlLayersStream::split() {
+    // <net> is the root, <layers> is its child and every <layer> is a child of <layers>
+    constexpr size_t net_depth = 0;
+    constexpr size_t layers_depth = 1;
+    constexpr size_t layer_depth = 2;
+
+    size_t depth = 0;
+    size_t pos = 0;
+    size_t layer_begin = 0;
+    size_t layer_header_end = 0;
+    size_t content_begin = 0;
+    bool in_layers = false;
+    Tag tag;
+    while (next_tag(m_text, pos, tag)) {
+        pos = tag.end;
+        switch (tag.kind) {
+        case TagKind::other:
+            break;
+        case TagKind::open:
+            if (depth == net_depth && tag.name != "net")
+                return false;
+            if (depth == layers_depth && tag.name == "layers" && !in_layers) {
+                in_layers = true;
+                content_begin = tag.end;
+            } else if (in_layers && depth == layer_depth) {
+                if (tag.name != "layer")
+                    return false;
+                layer_begin = tag.begin;
+                layer_header_end = tag.end;
+            }
+            ++depth;
+            break;
+        case TagKind::self_closing:
+            if (depth == net_depth)
+                return false;
+            if (in_layers && depth == layer_depth) {
+                if (tag.name != "layer")
+                    return false;
+                m_layers.push_back({tag.begin, tag.end, tag.end});
+            }
+            break;
+        case TagKind::close:
+            if (depth == net_depth)
+                return false;
+            --depth;
+            if (in_layers && depth == layer_depth) {
+                m_layers.push_back({layer_begin, layer_header_end, tag.end});
+            } else if (in_layers && depth == layers_depth) {
+                m_cut_begin = content_begin;
+                m_cut_size = tag.begin - content_begin;
+                m_skeleton.reserve(m_text.size() - m_cut_size);
+                m_skeleton.append(m_text, 0, content_begin);
+                m_skeleton.append(m_text, tag.begin, std::string::npos);
+                return true;
+            }
+            break;
+        }
+    }
+    return false;
+}
+
+pugi::xml_parse_result XmlLayersStream::load(std::istream& stream, pugi::xml_document& skeleton) {
+    const auto begin = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(begin);
+    if (begin >= 0 && end >= begin && stream) {
+        m_text.resize(static_cast<size_t>(end - begin));
+        stream.read(&m_text[0], m_text.size());
+        m_text.resize(static_cast<size_t>(stream.gcount()));
+    } else {
+        // the stream is not seekable
+        stream.clear();
+        m_text.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    m_split = split();
+    if (!m_split) {
+        m_layers.clear();
+        m_skeleton.clear();
+        m_skeleton.swap(m_text);
+    }
+
+    auto res = skeleton.load_buffer_inplace(&m_skeleton[0], m_skeleton.size());
+    m_encoding = res.encoding;
+    // report the offset in the original text
+    if (m_split && res.offset > static_cast<ptrdiff_t>(m_cut_begin))
+        res.offset += m_cut_size;
+    return res;
+}
+
+pugi::xml_node XmlLayersStream::parse_layer(size_t index, pugi::xml_document& doc) const {
+    const auto& layer = m_layers.at(index);
+    auto res = doc.load_buffer(m_text.data() + layer.begin,
+                               layer.end - layer.begin,
+                               pugi::parse_default,
+                               m_encoding);
+    if (res.status != pugi::status_ok) {
+        IE_THROW() << res.description() << " at offset " << layer.begin + res.offset;
+    }
+    return doc.document_element();
+}
+
+pugi::xml_node XmlLayersStream::parse_layer_header(size_t index, pugi::xml_document& doc) const {
+    const auto& layer = m_layers.at(index);
+    // the start tag is closed to be parsed as an empty element
+    std::string header(m_text, layer.begin, layer.header_end - layer.begin);
+    if (layer.header_end != layer.end)
+        header.insert(header.size() - 1, "/");
+    auto res = doc.load_buffer(header.data(), header.size(), pugi::parse_default, m_encoding);
+    if (res.status != pugi::status_ok) {
+        IE_THROW() << res.description() << " at offset " << layer.begin + res.offset;
+    }
+    return doc.document_element();
+}
+
+pugi::xml_node XmlLayersStream::load_layer(size_t index, pugi::xml_document& doc) const {
+    if (!m_topology)
+        return parse_layer(index, doc);
+    const auto& layer = ir_topology::records<ir_topology::Layer>(m_topology, m_topology->layers_offset)[index];
+    if (!(layer.flags & ir_topology::complete_layer))
+        return parse_layer(index, doc);
+
+    const auto strings = ir_topology::records<char>(m_topology, m_topology->strings_offset);
+    const auto attributes = ir_topology::records<ir_topology::Attribute>(m_topology, m_topology->attributes_offset);
+    doc.reset();
+    auto node = doc.append_child("layer");
+    node.append_attribute("id").set_value(std::to_string(layer.id).c_str());
+    node.append_attribute("name").set_value(strings + layer.name);
+    node.append_attribute("type").set_value(strings + layer.type);
+    node.append_attribute("version").set_value(strings + layer.version);
+    if (layer.attributes_count) {
+        auto data = node.append_child("data");
+        for (uint32_t i = 0; i < layer.attributes_count; ++i) {
+            const auto& attribute = attributes[layer.first_attribute + i];
+            data.append_attribute(strings + attribute.name).set_value(strings + attribute.value);
+        }
+    }
+    return node;
+}
+
+bool XmlLayersStream::set_topology(const ir_topology::Header* topology) {
+    m_topology = nullptr;
+    if (!m_split || !topology || topology->layers_count != m_layers.size() || topology->xml_size != m_text.size())
+        return false;
+    if (topology->xml_hash != ir_topology::hash(m_text.data(), m_text.size()))
+        return false;
+    m_topology = topology;
+    return true;
+}
+
+}  // namespace ov
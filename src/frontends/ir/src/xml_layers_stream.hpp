@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <pugixml.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ir_topology.hpp"
+
+namespace ov {
+
+/**
+ * @brief Keeps the layers of the top-level model as raw xml text and parses them one by one.
+ *
+ * The DOM of a huge IR takes several times more memory than its text, so only the "skeleton" of the document
+ * (the net element, edges, meta data, etc.) is parsed into the DOM, and every layer of the top-level model is parsed
+ * into a small document right before the creation of its node. The bodies of TensorIterator, Loop and If are parsed
+ * together with their layer.
+ */
+class XmlLayersStream {
+public:
+    /**
+     * @brief Reads the xml text from the stream and parses the skeleton of the document
+     * @param stream model stream, the model is read from the current position
+     * @param skeleton document to parse the skeleton into. If the layers section is not recognized, the whole
+     * document is parsed into it.
+     */
+    pugi::xml_parse_result load(std::istream& stream, pugi::xml_document& skeleton);
+
+    /**
+     * @brief Returns true if the layers are cut out of the skeleton and must be read from the stream
+     */
+    bool is_split() const {
+        return m_split;
+    }
+
+    /**
+     * @brief Returns the number of the top-level layers
+     */
+    size_t size() const {
+        return m_layers.size();
+    }
+
+    /**
+     * @brief Parses the layer with the given index, the previous content of the document is released
+     * @return layer xml node
+     */
+    pugi::xml_node parse_layer(size_t index, pugi::xml_document& doc) const;
+
+    /**
+     * @brief Parses only the start tag of the layer with the given index (its id, name, type, etc.), without the ports
+     * and the data, the previous content of the document is released
+     * @return layer xml node without children
+     */
+    pugi::xml_node parse_layer_header(size_t index, pugi::xml_document& doc) const;
+
+    /**
+     * @brief Returns the layer with the given index for the creation of its node. The layer which is completely
+     * described by the attached binary topology is built from its records without parsing of the xml: it has only
+     * the attributes of the operation ("data" element), the ports are taken from the topology too.
+     * Other layers are parsed, the previous content of the document is released
+     * @return layer xml node
+     */
+    pugi::xml_node load_layer(size_t index, pugi::xml_document& doc) const;
+
+    /**
+     * @brief Attaches the binary topology of the layers if it is written for the same xml text
+     * @param topology binary topology from the weights file or nullptr
+     * @return true if the topology is attached
+     */
+    bool set_topology(const ir_topology::Header* topology);
+
+    /**
+     * @brief Returns the binary topology of the layers or nullptr if it's not attached
+     */
+    const ir_topology::Header* get_topology() const {
+        return m_topology;
+    }
+
+private:
+    bool split();
+
+    std::string m_text;
+    // the document parses the skeleton in place, so the buffer must outlive it
+    std::string m_skeleton;
+    struct LayerText {
+        size_t begin;
+        size_t header_end;
+        size_t end;
+    };
+    std::vector<LayerText> m_layers;
+    size_t m_cut_begin = 0;
+    size_t m_cut_size = 0;
+    pugi::xml_encoding m_encoding = pugi::encoding_auto;
+    bool m_split = false;
+    const ir_topology::Header* m_topology = nullptr;
+};
+
+}  // namespace ov
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "ir_topology.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/openvino.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
+
+// The layer name is patched in the binary topology only, so the name of the node shows which of the sections
+// the generic layer parameters are taken from
+class IRBinaryTopologyTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        serialize(false);
+    }
+
+    void serialize(bool with_rt_info) {
+        auto parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        parameter->set_friendly_name("input");
+        auto constant = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 3}, {1.f, 2.f, 3.f});
+        auto add = std::make_shared<ov::opset8::Add>(parameter, constant);
+        add->set_friendly_name(xml_name);
+        // the layer with runtime info is parsed from the xml
+        if (with_rt_info)
+            add->get_rt_info()[ov::FusedNames::get_type_info_static()] = ov::FusedNames("fused");
+        auto result = std::make_shared<ov::opset8::Result>(add);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+
+        std::stringstream xml_stream, bin_stream;
+        ov::pass::Serialize(xml_stream, bin_stream, ov::pass::Serialize::Version::UNSPECIFIED, true)
+            .run_on_model(model);
+        xml = xml_stream.str();
+        bin = bin_stream.str();
+
+        // the name is in the string pool of the topology, which is the only text in the weights
+        const auto name_pos = bin.find(xml_name + '\0');
+        ASSERT_NE(name_pos, std::string::npos);
+        bin.replace(name_pos, topology_name.size(), topology_name);
+    }
+
+    std::shared_ptr<ov::Node> read_add(const std::string& model_xml) {
+        ov::Tensor weights(ov::element::u8, ov::Shape{bin.size()});
+        std::memcpy(weights.data(), bin.data(), bin.size());
+        std::shared_ptr<ov::Model> model;
+        EXPECT_NO_THROW(model = core.read_model(model_xml, weights));
+        if (!model)
+            return {};
+        for (const auto& op : model->get_ops()) {
+            if (ov::is_type<ov::opset8::Add>(op))
+                return op;
+        }
+        return {};
+    }
+
+    std::string read_add_name(const std::string& model_xml) {
+        const auto add = read_add(model_xml);
+        return add ? add->get_friendly_name() : std::string{};
+    }
+
+    // the attribute values are in the string pool of the topology too
+    void patch_auto_broadcast() {
+        const std::string numpy{"numpy", sizeof("numpy")};
+        const auto value_pos = bin.find(numpy);
+        ASSERT_NE(value_pos, std::string::npos);
+        std::string none{"none"};
+        none.resize(numpy.size(), '\0');
+        bin.replace(value_pos, numpy.size(), none);
+    }
+
+    // the section is followed by the trailer, the weights buffer gives no alignment guarantees
+    size_t trailer_pos() const {
+        return bin.size() - sizeof(ov::ir_topology::Trailer);
+    }
+
+    uint64_t get_section_size() const {
+        uint64_t size;
+        std::memcpy(&size, &bin[trailer_pos() + offsetof(ov::ir_topology::Trailer, size)], sizeof(size));
+        return size;
+    }
+
+    void set_u64(size_t pos, uint64_t value) {
+        std::memcpy(&bin[pos], &value, sizeof(value));
+    }
+
+    ov::Core core;
+    const std::string xml_name = "add_layer";
+    const std::string topology_name = "add_LAYER";
+    std::string xml;
+    std::string bin;
+};
+
+TEST_F(IRBinaryTopologyTests, topology_is_used) {
+    ASSERT_EQ(bin.compare(bin.size() - 8, 8, ov::ir_topology::magic()), 0);
+    ASSERT_EQ(read_add_name(xml), topology_name);
+}
+
+TEST_F(IRBinaryTopologyTests, attributes_are_taken_from_topology) {
+    patch_auto_broadcast();
+    const auto add = read_add(xml);
+    ASSERT_NE(add, nullptr);
+    ASSERT_EQ(add->get_friendly_name(), topology_name);
+    ASSERT_EQ(add->get_autob().m_type, ov::op::AutoBroadcastType::NONE);
+}
+
+TEST_F(IRBinaryTopologyTests, layer_with_rt_info_is_parsed_from_xml) {
+    serialize(true);
+    patch_auto_broadcast();
+    const auto add = read_add(xml);
+    ASSERT_NE(add, nullptr);
+    // the generic parameters are still taken from the topology
+    ASSERT_EQ(add->get_friendly_name(), topology_name);
+    ASSERT_EQ(add->get_autob().m_type, ov::op::AutoBroadcastType::NUMPY);
+    ASSERT_EQ(add->get_rt_info().count(ov::FusedNames::get_type_info_static()), 1);
+}
+
+TEST_F(IRBinaryTopologyTests, stale_topology_is_ignored) {
+    // the same size of the xml, but the hash differs
+    const std::string new_name = "add_lAyer";
+    const auto name_pos = xml.find(xml_name);
+    ASSERT_NE(name_pos, std::string::npos);
+    xml.replace(name_pos, new_name.size(), new_name);
+
+    ASSERT_EQ(read_add_name(xml), new_name);
+}
+
+TEST_F(IRBinaryTopologyTests, topology_with_wrong_magic_is_ignored) {
+    bin[bin.size() - 1] = 'X';
+    ASSERT_EQ(read_add_name(xml), xml_name);
+}
+
+TEST_F(IRBinaryTopologyTests, topology_with_wrong_size_is_ignored) {
+    set_u64(trailer_pos() + offsetof(ov::ir_topology::Trailer, size), bin.size());
+    ASSERT_EQ(read_add_name(xml), xml_name);
+}
+
+TEST_F(IRBinaryTopologyTests, topology_with_corrupted_header_is_ignored) {
+    const size_t header_pos = trailer_pos() - get_section_size();
+    set_u64(header_pos + offsetof(ov::ir_topology::Header, layers_count), std::numeric_limits<uint32_t>::max());
+    ASSERT_EQ(read_add_name(xml), xml_name);
+}
+
+TEST_F(IRBinaryTopologyTests, truncated_topology_is_ignored) {
+    // the weights end in the middle of the section
+    bin.resize(bin.size() - 24);
+    ASSERT_EQ(read_add_name(xml), xml_name);
+}
@@ -198,9 +198,14 @@ public:
     };
 
     Attribute() = delete;
-    explicit Attribute(const ONNX_NAMESPACE::AttributeProto& attribute_proto, const std::string& model_dir)
+    explicit Attribute(const ONNX_NAMESPACE::AttributeProto& attribute_proto,
+                       const std::string& model_dir,
+                       detail::MappedMemoryHandles mmap_cache = nullptr,
+                       std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_attribute_proto{&attribute_proto},
-          m_model_dir{model_dir} {}
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)},
+          m_model_proto{std::move(model_proto)} {}
 
     Attribute(Attribute&&) noexcept = default;
     Attribute(const Attribute&) = default;
@@ -251,7 +256,7 @@ public:
         return get_type() == Type::graph_array;
     }
     Tensor get_tensor() const {
-        return Tensor{m_attribute_proto->t(), m_model_dir};
+        return Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache, m_model_proto};
     }
     SparseTensor get_sparse_tensor() const {
         return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir};
@@ -272,7 +277,7 @@ public:
         const auto& tensors = m_attribute_proto->tensors();
         ret.reserve(tensors.size());
         for (const auto& tensor : tensors)
-            ret.emplace_back(tensor, m_model_dir);
+            ret.emplace_back(tensor, m_model_dir, m_mmap_cache, m_model_proto);
         return ret;
     }
 
@@ -313,7 +318,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, Tensor>::value, bool>::type = true>
     T get_value() const {
         if (is_tensor()) {
-            return Tensor{m_attribute_proto->t(), m_model_dir};
+            return Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache, m_model_proto};
         }
         throw error::attribute::InvalidData{m_attribute_proto->type()};
     }
@@ -321,7 +326,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, std::vector<Tensor>>::value, bool>::type = true>
     T get_value() const {
         if (is_tensor()) {
-            return {Tensor{m_attribute_proto->t(), m_model_dir}};
+            return {Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache, m_model_proto}};
         } else if (is_tensor_array()) {
             return get_tensor_array();
         }
@@ -351,6 +356,8 @@ public:
 private:
     const ONNX_NAMESPACE::AttributeProto* m_attribute_proto;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
 };
 
 }  // namespace onnx_import
@@ -21,6 +21,7 @@
 #include "openvino/frontend/onnx/extension/conversion.hpp"
 #include "openvino/frontend/onnx/node_context.hpp"
 #include "ops_bridge.hpp"
+#include "parallel_executor.hpp"
 #include "utils/common.hpp"
 #include "utils/legacy_conversion_extension.hpp"
 
@@ -117,6 +118,19 @@ Model::ModelOpSet build_model_opset(const ONNX_NAMESPACE::ModelProto& model_prot
     return opset;
 }
 
+/// Creates a Constant node for a graph initializer.
+/// Initializers which can not be decoded are replaced with failsafe constants.
+std::shared_ptr<default_opset::Constant> decode_initializer(const Tensor& tensor) {
+    try {
+        return tensor.get_ng_constant();
+    } catch (const error::invalid_external_data&) {
+        // invalid external data makes initializers creation impossible
+        throw;
+    } catch (const ngraph::ngraph_error&) {
+        return ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
+    }
+}
+
 /// Copies only the extensions required by the Subgraph class.
 /// The source is an extension holder retrieved from the parent graph object.
 ov::frontend::ExtensionHolder subgraph_required_extensions(
@@ -131,15 +145,21 @@ ov::frontend::ExtensionHolder subgraph_required_extensions(
 Graph::Graph(const std::string& model_dir,
              const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
              ov::frontend::ExtensionHolder extensions)
-    : Graph(model_dir, model_proto, common::make_unique<GraphCache>(), std::move(extensions)) {}
+    : Graph(model_dir,
+            model_proto,
+            common::make_unique<GraphCache>(),
+            std::make_shared<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>(),
+            std::move(extensions)) {}
 
 Graph::Graph(const std::string& model_dir,
              const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
              std::unique_ptr<GraphCache>&& cache,
+             detail::MappedMemoryHandles mmap_cache,
              ov::frontend::ExtensionHolder extensions)
     : m_cache{std::move(cache)},
       m_extensions{std::move(extensions)},
-      m_model_dir{model_dir} {
+      m_model_dir{model_dir},
+      m_mmap_cache{std::move(mmap_cache)} {
     const auto ops_bridge = detail::init_ops_bridge(m_extensions.conversions);
     m_model = common::make_unique<Model>(model_proto, detail::build_model_opset(*model_proto, ops_bridge));
 
@@ -147,25 +167,47 @@ Graph::Graph(const std::string& model_dir,
 
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
+    // Map all external data files upfront. This validates the external data of every initializer
+    // and makes the decoding below only read the shared cache of mappings.
+    std::vector<Tensor> initializer_tensors;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ng_constant = tensor.get_ng_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ngraph::ngraph_error&) {
-                ng_constant = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
+            if (initializer_tensor.has_data_location() &&
+                initializer_tensor.data_location() ==
+                    ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+                detail::TensorExternalData(initializer_tensor).load_external_mmap_data(m_model_dir, m_mmap_cache);
             }
+            initializer_tensors.emplace_back(initializer_tensor, m_model_dir, m_mmap_cache, model_proto);
+        }
+    }
+
+    // Decode the initializers to Constant nodes in parallel, Constants do not depend on any other node.
+    // A few small initializers are decoded in the calling thread.
+    size_t initializers_elements = 0;
+    for (const auto& tensor : initializer_tensors) {
+        initializers_elements += shape_size(tensor.get_shape());
+    }
+    const size_t initializer_cost =
+        initializer_tensors.empty() ? 0 : initializers_elements / initializer_tensors.size();
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(initializer_tensors.size());
+    std::vector<std::exception_ptr> decoding_errors(initializer_tensors.size());
+    ov::threading::parallel_for(initializer_tensors.size(), initializer_cost, [&](size_t i) {
+        try {
+            ng_constants[i] = detail::decode_initializer(initializer_tensors[i]);
+        } catch (...) {
+            decoding_errors[i] = std::current_exception();
+        }
+    });
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+    // Store the Constants in the cache in the order of the initializers, reporting the first error if any
+    for (size_t i = 0; i < initializer_tensors.size(); ++i) {
+        if (decoding_errors[i]) {
+            std::rethrow_exception(decoding_errors[i]);
         }
+        const auto& name = initializer_tensors[i].get_name();
+        initializers.emplace(name, initializer_tensors[i]);
+        ng_constants[i]->get_output_tensor(0).set_names({name});
+        m_cache->emplace_node(name, std::move(ng_constants[i]));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -461,6 +503,7 @@ Subgraph::Subgraph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_prot
     : Graph(parent_graph->model_dir(),
             model_proto,
             common::make_unique<GraphCache>(),
+            parent_graph->get_mmap_cache(),
             detail::subgraph_required_extensions(parent_graph->get_extensions())),
       m_parent_graph(parent_graph) {}
 
@@ -40,6 +40,9 @@ public:
     const std::string& get_producer_name() const {
         return m_model_proto->producer_name();
     }
+    const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& get_model_proto() const {
+        return m_model_proto;
+    }
     const ONNX_NAMESPACE::GraphProto& get_graph() const {
         return m_model_proto->graph();
     }
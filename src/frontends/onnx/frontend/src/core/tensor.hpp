@@ -105,10 +105,17 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    /// \param model_proto  Optional owner of the tensor message. When it is set, Constants created from
+    ///                     raw_data share the bytes of the message instead of copying them.
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = nullptr,
+                    std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)},
+          m_model_proto{std::move(model_proto)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -194,6 +201,18 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (has_external_data()) {
+            return make_ng_constant_from_buffer(get_ng_type(), load_external_mmap_data());
+        }
+        if (m_tensor_proto->has_raw_data() && m_model_proto) {
+            const auto& raw_data = m_tensor_proto->raw_data();
+            return make_ng_constant_from_buffer(
+                get_ng_type(),
+                std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>>(
+                    const_cast<char*>(raw_data.data()),
+                    raw_data.size(),
+                    m_model_proto));
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -235,10 +254,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         int data_size = get_data_size();
-        if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -280,14 +296,39 @@ private:
                    ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
-    std::string load_external_data() const {
+    detail::Buffer<ov::MappedMemory> load_external_mmap_data() const {
         const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
-        return tensor_external_data.load_external_data(m_model_dir);
+        return tensor_external_data.load_external_mmap_data(
+            m_model_dir,
+            m_mmap_cache,
+            shape_size(m_shape) * onnx_common::get_onnx_data_size(m_tensor_proto->data_type()));
+    }
+
+    // The returned Constant does not copy the data, it keeps the owner of the buffer (a memory mapping
+    // of the external data file or the ModelProto) alive instead
+    template <typename T>
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_buffer(const element::Type& type,
+                                                                       const detail::Buffer<T>& buffer) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (buffer->size() == shape_size(m_shape) * type.size()) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        } else if (buffer->size() == 0 && m_shape.size() == 0) {
+            constant = common::make_failsafe_constant(type);
+        } else {
+            throw error::tensor::shape_doesnt_match_data_size{};
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
     }
 
     template <typename T>
     std::vector<T> get_external_data() const {
-        return detail::__get_raw_data<T>(load_external_data(), m_tensor_proto->data_type());
+        const auto buffer = load_external_mmap_data();
+        const auto begin = buffer->get_ptr<T>();
+        return std::vector<T>(begin,
+                              begin + buffer->size() / onnx_common::get_onnx_data_size(m_tensor_proto->data_type()));
     }
 
     const void* get_data_ptr() const {
@@ -331,6 +372,8 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
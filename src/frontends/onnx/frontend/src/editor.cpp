@@ -214,22 +214,38 @@ struct onnx_editor::ONNXModelEditor::Impl {
     std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
     EdgeMapper m_edge_mapper;
     bool m_is_mapper_updated = false;
+    // Constants of the models created from the proto share the raw_data of its initializers, so the proto must not
+    // be modified in place once a model is created from it
+    bool m_is_model_proto_shared = false;
 
     Impl() = delete;
 
     Impl(const std::string& model_path)
-        : m_model_proto{
-              std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
+        : m_model_proto{ngraph::onnx_common::parse_from_file(model_path)} {}
 
     Impl(std::istream& model_stream)
-        : m_model_proto{
-              std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_istream(model_stream))} {}
+        : m_model_proto{ngraph::onnx_common::parse_from_istream(model_stream)} {}
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     Impl(const std::wstring& model_path)
-        : m_model_proto{
-              std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))} {}
+        : m_model_proto{ngraph::onnx_common::parse_from_file(model_path)} {}
 #endif
+
+    /// \brief Makes a private copy of the proto if it's shared with the models created before
+    void detach_model_proto() {
+        if (m_is_model_proto_shared) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+            m_is_model_proto_shared = false;
+        }
+    }
+
+    /// \brief Returns the proto to create a model from, the proto is not modified in place after that
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> share_model_proto() {
+        // the conversion applies the transformations to the proto
+        detach_model_proto();
+        m_is_model_proto_shared = true;
+        return m_model_proto;
+    }
 };
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path, frontend::ExtensionHolder extensions)
@@ -276,6 +292,7 @@ void onnx_editor::ONNXModelEditor::serialize(const std::string& out_file_path) c
 }
 
 void onnx_editor::ONNXModelEditor::set_input_types(const std::map<std::string, element::Type_t>& input_types) {
+    m_pimpl->detach_model_proto();
     auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input_desc : input_types) {
@@ -309,6 +326,7 @@ element::Type_t onnx_editor::ONNXModelEditor::get_input_type(const std::string&
 }
 
 void onnx_editor::ONNXModelEditor::set_input_shapes(const std::map<std::string, ngraph::PartialShape>& input_shapes) {
+    m_pimpl->detach_model_proto();
     auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input_desc : input_shapes) {
@@ -371,6 +389,7 @@ void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>
         return;
     }
 
+    m_pimpl->detach_model_proto();
     InferShapesAutoRelease onnx_shapes(m_pimpl->m_model_proto);
     onnx_shapes.infer_shapes();
 
@@ -444,11 +463,12 @@ std::string onnx_editor::ONNXModelEditor::model_string() const {
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
-    return ngraph::onnx_import::detail::import_onnx_model(m_pimpl->m_model_proto, m_model_path, m_extensions);
+    return ngraph::onnx_import::detail::import_onnx_model(m_pimpl->share_model_proto(), m_model_path, m_extensions);
 }
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
@@ -472,6 +492,7 @@ void onnx_editor::ONNXModelEditor::set_input_values(
 }
 
 void onnx_editor::ONNXModelEditor::set_tensor_name(const std::string& current_name, const std::string& new_name) {
+    m_pimpl->detach_model_proto();
     OPENVINO_ASSERT(!new_name.empty(), "New name must not be empty.");
 
     const auto graph = m_pimpl->m_model_proto->mutable_graph();
@@ -515,6 +536,7 @@ void onnx_editor::ONNXModelEditor::set_tensor_name(const std::string& current_na
 }
 
 void onnx_editor::ONNXModelEditor::set_node_name(const EditorNode& node, const std::string& new_name) {
+    m_pimpl->detach_model_proto();
     const auto node_idx = m_pimpl->m_edge_mapper.get_node_index(node);
     const auto graph = m_pimpl->m_model_proto->mutable_graph();
 
@@ -536,6 +558,7 @@ std::string onnx_editor::ONNXModelEditor::get_node_name(const EditorNode& node)
 }
 
 void onnx_editor::ONNXModelEditor::clear_nodes_name(const std::string& name) {
+    m_pimpl->detach_model_proto();
     const auto graph = m_pimpl->m_model_proto->mutable_graph();
 
     m_pimpl->m_is_mapper_updated = false;
@@ -552,6 +575,7 @@ void onnx_editor::ONNXModelEditor::set_name_for_dimension(const std::string& nod
                                                           const std::string& dim_name) {
     OPENVINO_ASSERT(!dim_name.empty(), "Dimension name must not be empty.");
 
+    m_pimpl->detach_model_proto();
     const auto graph = m_pimpl->m_model_proto->mutable_graph();
 
     OPENVINO_ASSERT(!find_graph_initializer(*graph, node_name), "ONNX initializer shape dimension cannot be dynamic.");
@@ -635,10 +659,13 @@ std::vector<std::string> onnx_editor::ONNXModelEditor::get_output_ports(const Ed
 }
 
 std::shared_ptr<Model> onnx_editor::ONNXModelEditor::decode() {
-    return ngraph::onnx_import::detail::decode_to_framework_nodes(m_pimpl->m_model_proto, m_model_path, m_extensions);
+    return ngraph::onnx_import::detail::decode_to_framework_nodes(m_pimpl->share_model_proto(),
+                                                                  m_model_path,
+                                                                  m_extensions);
 }
 
 void onnx_editor::ONNXModelEditor::add_output(const OutputEdge& output_edge) const {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
     std::vector<onnx_editor::OutputEdge> onnx_output;
     onnx_output.push_back(output_edge);
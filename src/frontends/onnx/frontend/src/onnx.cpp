@@ -23,7 +23,7 @@ const auto legacy_conversion_extension = std::make_shared<ngraph::onnx_import::L
 namespace ngraph {
 namespace onnx_import {
 std::shared_ptr<Function> import_onnx_model(std::istream& stream, const std::string& model_path) {
-    const auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(onnx_common::parse_from_istream(stream));
+    const auto model_proto = onnx_common::parse_from_istream(stream);
     ov::frontend::ExtensionHolder extensions;
     extensions.conversions.push_back(legacy_conversion_extension);
     return detail::import_onnx_model(model_proto, model_path, std::move(extensions));
@@ -4,7 +4,6 @@
 
 #include "utils/tensor_external_data.hpp"
 
-#include <fstream>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -31,45 +30,54 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     }
 }
 
-std::string TensorExternalData::load_external_data(const std::string& model_dir) const {
+Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                                    const MappedMemoryHandles& cache,
+                                                                    uint64_t expected_length) const {
     NGRAPH_SUPPRESS_DEPRECATED_START
-
     auto full_path = file_util::path_join(model_dir, m_data_location);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     file_util::convert_path_win_style(full_path);
-    std::ifstream external_data_stream(ov::util::string_to_wstring(full_path),
-                                       std::ios::binary | std::ios::in | std::ios::ate);
-#else
-    std::ifstream external_data_stream(full_path, std::ios::binary | std::ios::in | std::ios::ate);
 #endif
     NGRAPH_SUPPRESS_DEPRECATED_END
 
-    if (external_data_stream.fail())
-        throw error::invalid_external_data{*this};
-
-    auto filesize = external_data_stream.tellg();
-    if (filesize == -1) {
-        throw error::invalid_external_data{*this};
+    std::shared_ptr<ov::MappedMemory> mapped_memory;
+    if (cache) {
+        const auto cached = cache->find(full_path);
+        if (cached != cache->end()) {
+            mapped_memory = cached->second;
+        }
     }
-    if (m_offset + m_data_length > filesize) {
-        throw error::invalid_external_data{*this};
+    if (!mapped_memory) {
+        try {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::load_mmap_object(ov::util::string_to_wstring(full_path));
+#else
+            mapped_memory = ov::load_mmap_object(full_path);
+#endif
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        if (cache) {
+            cache->emplace(full_path, mapped_memory);
+        }
     }
 
-    uint64_t read_data_length = m_data_length > 0 ? m_data_length : static_cast<uint64_t>(filesize) - m_offset;
-
-    // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
+    const uint64_t file_size = mapped_memory->size();
+    // Without the length the data only has to fit in the file, the bytes after it may belong to other tensors
+    const uint64_t read_data_length =
+        m_data_length > 0 ? m_data_length : (expected_length > 0 ? expected_length : file_size - m_offset);
+    if (m_offset > file_size || m_offset + read_data_length > file_size) {
+        throw error::invalid_external_data{*this};
+    }
 
     if (m_sha1_digest.size() > 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
-
-    return read_data;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        static_cast<size_t>(read_data_length),
+        mapped_memory);
 }
 
 std::string TensorExternalData::to_string() const {
@@ -6,22 +6,41 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+template <class T>
+using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<T>>>;
+/// \brief  Maps full paths of external data files to their memory mappings, so that every file
+///         referenced by many tensors is mapped only once per model.
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::MappedMemory>>>;
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
     TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
-    /// \brief      Load external data from tensor passed to constructor
+    /// \brief      Map external data from tensor passed to constructor into memory
     ///
-    /// \note       If read data from external file fails,
-    /// \note       If reading data from external files fails,
+    /// \note       If the file can not be mapped or the requested region lies outside of it,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data(const std::string& model_dir) const;
+    /// \param      model_dir  Directory the external data location is relative to
+    /// \param      cache      Optional storage of already mapped files, reused and updated by this call
+    /// \param      expected_length  Size of the tensor data in bytes, used when the length is not given;
+    ///                              if it is 0 as well, the data lasts until the end of the file
+    ///
+    /// \return     Buffer viewing the external data inside of the mapped file, the mapping is kept
+    ///             alive for as long as the buffer exists
+    Buffer<ov::MappedMemory> load_external_mmap_data(const std::string& model_dir,
+                                                     const MappedMemoryHandles& cache = nullptr,
+                                                     uint64_t expected_length = 0) const;
 
     /// \brief      Represets parameter of external data as string
     ///
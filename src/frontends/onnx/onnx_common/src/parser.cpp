@@ -4,45 +4,75 @@
 
 #include "onnx_common/parser.hpp"
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
 #include <onnx/onnx_pb.h>
 
+#include <limits>
 #include <ngraph/file_util.hpp>
 
 #include "ngraph/except.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ngraph {
 namespace onnx_common {
-ONNX_NAMESPACE::ModelProto parse_from_file(const std::string& file_path) {
-    std::ifstream file_stream{file_path, std::ios::in | std::ios::binary};
+namespace {
+/// \brief   Creates an empty ModelProto allocated in its own protobuf arena.
+///
+/// \note    All nested messages of the model are allocated in the same arena which makes parsing
+///          of graphs with many nodes and initializers cheaper and releases them at once.
+///          The returned pointer shares the ownership of the arena.
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> make_model_proto() {
+    const auto arena = std::make_shared<google::protobuf::Arena>();
+    const auto model_proto = google::protobuf::Arena::Create<ONNX_NAMESPACE::ModelProto>(arena.get());
+    return std::shared_ptr<ONNX_NAMESPACE::ModelProto>{arena, model_proto};
+}
 
-    if (!file_stream.is_open()) {
-        throw ngraph_error("Could not open the file: " + file_path);
-    };
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_mapped_memory(const std::shared_ptr<ov::MappedMemory>& mapped,
+                                                                     const std::string& file_path) {
+    if (mapped->size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw ngraph_error("The ONNX model " + file_path +
+                           " exceeds the 2GB protobuf limit. Save its weights as external data instead.");
+    }
 
-    auto model_proto = parse_from_istream(file_stream);
-    file_stream.close();
+    auto model_proto = make_model_proto();
+    google::protobuf::io::ArrayInputStream model_stream{mapped->data(), static_cast<int>(mapped->size())};
+    if (!model_proto->ParseFromZeroCopyStream(&model_stream)) {
+        throw ngraph_error("Error during import of ONNX model from file " + file_path +
+                           " with binary protobuf message.");
+    }
     return model_proto;
 }
+}  // namespace
 
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-ONNX_NAMESPACE::ModelProto parse_from_file(const std::wstring& file_path) {
-    std::ifstream file_stream{file_path, std::ios::in | std::ios::binary};
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_file(const std::string& file_path) {
+    std::shared_ptr<ov::MappedMemory> mapped_file;
+    try {
+        mapped_file = ov::load_mmap_object(file_path);
+    } catch (const std::runtime_error&) {
+        throw ngraph_error("Could not open the file: " + file_path);
+    }
+    return parse_from_mapped_memory(mapped_file, file_path);
+}
 
-    if (!file_stream.is_open()) {
-        NGRAPH_SUPPRESS_DEPRECATED_START
-        throw ngraph_error("Could not open the file: " + file_util::wstring_to_string(file_path));
-        NGRAPH_SUPPRESS_DEPRECATED_END
-    };
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_file(const std::wstring& file_path) {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    const auto file_path_str = file_util::wstring_to_string(file_path);
+    NGRAPH_SUPPRESS_DEPRECATED_END
 
-    auto model_proto = parse_from_istream(file_stream);
-    file_stream.close();
-    return model_proto;
+    std::shared_ptr<ov::MappedMemory> mapped_file;
+    try {
+        mapped_file = ov::load_mmap_object(file_path);
+    } catch (const std::runtime_error&) {
+        throw ngraph_error("Could not open the file: " + file_path_str);
+    }
+    return parse_from_mapped_memory(mapped_file, file_path_str);
 }
 #endif
 
-ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream) {
+std::shared_ptr<ONNX_NAMESPACE::ModelProto> parse_from_istream(std::istream& model_stream) {
     if (!model_stream.good()) {
         model_stream.clear();
         model_stream.seekg(0);
@@ -51,8 +81,8 @@ ONNX_NAMESPACE::ModelProto parse_from_istream(std::istream& model_stream) {
         }
     }
 
-    ONNX_NAMESPACE::ModelProto model_proto;
-    if (!model_proto.ParseFromIstream(&model_stream)) {
+    auto model_proto = make_model_proto();
+    if (!model_proto->ParseFromIstream(&model_stream)) {
         throw ngraph_error("Error during import of ONNX model provided as input stream "
                            " with binary protobuf message.");
     }
@@ -1460,6 +1460,49 @@ NGRAPH_TEST(onnx_editor, values__append_two_initializers_mixed_types) {
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_editor, values__modify_initializers_after_conversion) {
+    onnx_editor::ONNXModelEditor editor{
+        ngraph::file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                     SERIALIZED_ZOO,
+                                     "onnx/model_editor/add_1D_with_initializers_only.onnx")};
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+
+    // the new values are stored as raw_data, which is shared by the Constants of the converted models
+    in_vals.emplace("A", ngraph::op::Constant::create(element::i64, Shape{2}, {1, 2}));
+    in_vals.emplace("B", ngraph::op::Constant::create(element::i64, Shape{2}, {11, 22}));
+    editor.set_input_values(in_vals);
+    const auto function = editor.get_function();
+    const auto decoded_function = editor.decode();
+
+    in_vals.clear();
+    in_vals.emplace("A", ngraph::op::Constant::create(element::i64, Shape{2}, {3, 4}));
+    in_vals.emplace("B", ngraph::op::Constant::create(element::i64, Shape{2}, {5, 6}));
+    editor.set_input_values(in_vals);
+    editor.extract_subgraph({}, {OutputEdge{0, 0}});
+    const auto modified_function = editor.get_function();
+
+    for (const auto& model : {function, decoded_function}) {
+        size_t constants_count = 0;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (const auto constant = ov::as_type_ptr<ngraph::op::Constant>(op)) {
+                const auto expected = constant->get_friendly_name() == "A" ? std::vector<int64_t>{1, 2}
+                                                                           : std::vector<int64_t>{11, 22};
+                EXPECT_EQ(constant->cast_vector<int64_t>(), expected);
+                constants_count++;
+            }
+        }
+        EXPECT_EQ(constants_count, 2);
+    }
+
+    auto test_case = ngraph::test::TestCase(function);
+    test_case.add_expected_output<int64_t>(Shape{2}, {12, 24});
+    test_case.run();
+
+    auto modified_test_case = ngraph::test::TestCase(modified_function);
+    modified_test_case.add_expected_output<int64_t>(Shape{2}, {8, 10});
+    modified_test_case.run();
+}
+
 NGRAPH_TEST(onnx_editor, read_model_from_stream) {
     std::string path = ngraph::file_util::path_join(CommonTestUtils::getExecutableDirectory(),
                                                     SERIALIZED_ZOO,
@@ -93,6 +93,40 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_without_length) {
+    // the data of the first tensor is followed by the data of the second one in the file
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file_without_length.onnx"));
+
+    auto test_case = test::TestCase(function, s_device);
+    // first input: {3, 2, 1}, second: {1, 2, 3} read from external file
+    test_case.add_input<int32_t>({2, 3, 1});
+
+    test_case.add_expected_output<int32_t>({3, 3, 3});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_share_mapped_file) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<default_opset::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // both tensors are views into a single mapping of the data file, so their offsets are preserved
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+    EXPECT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -3,15 +3,21 @@
 //
 
 #include <gtest/gtest.h>
+#include <onnx/onnx_pb.h>
 
+#include <cstring>
 #include <fstream>
 #include <set>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "common_test_utils/file_utils.hpp"
 #include "onnx_import/onnx.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/openvino.hpp"
 #include "openvino/util/file_util.hpp"
+#include "parallel_executor.hpp"
 
 TEST(ONNX_Importer_Tests, ImportBasicModel) {
     auto model_file_path =
@@ -181,3 +187,118 @@ TEST(ONNX_Importer_Tests, ImportModelWithMetadata) {
     ASSERT_EQ(metadata["meta_key1"].as<std::string>(), "meta_value1");
     ASSERT_EQ(metadata["meta_key2"].as<std::string>(), "meta_value2");
 }
+
+TEST(ONNX_Importer_Tests, ParallelInitializersDecodingMatchesSerial) {
+    const auto model_file_path =
+        CommonTestUtils::getModelFromTestModelZoo(ov::util::path_join({ONNX_MODELS_DIR, "add_abc_initializers.onnx"}));
+
+    // Decode the initializers one by one in the calling thread to get the reference model.
+    ov::threading::ParallelExecutor serial;
+    serial.get_max_threads = [] {
+        return static_cast<size_t>(4);
+    };
+    serial.run = [](size_t nthr, const std::function<void(size_t, size_t)>& func) {
+        for (size_t ithr = 0; ithr < nthr; ++ithr)
+            func(ithr, nthr);
+    };
+    auto previous = ov::threading::set_parallel_executor(serial);
+    std::shared_ptr<ov::Model> serial_model;
+    try {
+        serial_model = ngraph::onnx_import::import_onnx_model(model_file_path);
+    } catch (...) {
+        ov::threading::set_parallel_executor(previous);
+        throw;
+    }
+    ov::threading::set_parallel_executor(previous);
+
+    const auto parallel_model = ngraph::onnx_import::import_onnx_model(model_file_path);
+
+    const auto serial_ops = serial_model->get_ordered_ops();
+    const auto parallel_ops = parallel_model->get_ordered_ops();
+    ASSERT_EQ(serial_ops.size(), parallel_ops.size());
+    for (size_t i = 0; i < serial_ops.size(); ++i) {
+        ASSERT_EQ(std::string(serial_ops[i]->get_type_name()), std::string(parallel_ops[i]->get_type_name()));
+        ASSERT_EQ(serial_ops[i]->get_friendly_name(), parallel_ops[i]->get_friendly_name());
+
+        const auto serial_const = ov::as_type_ptr<ov::op::v0::Constant>(serial_ops[i]);
+        if (!serial_const)
+            continue;
+        const auto parallel_const = ov::as_type_ptr<ov::op::v0::Constant>(parallel_ops[i]);
+        ASSERT_NE(parallel_const, nullptr);
+        ASSERT_EQ(serial_const->get_element_type(), parallel_const->get_element_type());
+        ASSERT_EQ(serial_const->get_shape(), parallel_const->get_shape());
+        ASSERT_EQ(serial_const->get_byte_size(), parallel_const->get_byte_size());
+        ASSERT_EQ(std::memcmp(serial_const->get_data_ptr(), parallel_const->get_data_ptr(), serial_const->get_byte_size()),
+                  0);
+    }
+}
+
+TEST(ONNX_Importer_Tests, ImportModelWithManyLargeInitializers) {
+    // Chain of Add nodes y_{i + 1} = y_i + w_i, every initializer w_i has its own values,
+    // so a mix-up of the initializers decoded in parallel is visible in the Constants
+    constexpr int64_t initializers_num = 64;
+    constexpr int64_t elements_num = 64 * 1024;
+    const auto expected_value = [](int64_t i, int64_t j) {
+        return static_cast<float>(i * elements_num + j);
+    };
+
+    ONNX_NAMESPACE::ModelProto model_proto;
+    model_proto.set_ir_version(7);
+    model_proto.add_opset_import()->set_version(13);
+    auto graph = model_proto.mutable_graph();
+    graph->set_name("many_large_initializers");
+    const auto set_value_info = [](ONNX_NAMESPACE::ValueInfoProto* value_info, const std::string& name) {
+        value_info->set_name(name);
+        auto tensor_type = value_info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(elements_num);
+    };
+    set_value_info(graph->add_input(), "y_0");
+    for (int64_t i = 0; i < initializers_num; ++i) {
+        const auto name = "w_" + std::to_string(i);
+        auto initializer = graph->add_initializer();
+        initializer->set_name(name);
+        initializer->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        initializer->add_dims(elements_num);
+        // raw_data and float_data are decoded differently, both are covered
+        if (i % 2 == 0) {
+            std::vector<float> values(elements_num);
+            for (int64_t j = 0; j < elements_num; ++j) {
+                values[j] = expected_value(i, j);
+            }
+            initializer->set_raw_data(values.data(), values.size() * sizeof(float));
+        } else {
+            for (int64_t j = 0; j < elements_num; ++j) {
+                initializer->add_float_data(expected_value(i, j));
+            }
+        }
+
+        auto node = graph->add_node();
+        node->set_op_type("Add");
+        node->add_input("y_" + std::to_string(i));
+        node->add_input(name);
+        node->add_output("y_" + std::to_string(i + 1));
+    }
+    set_value_info(graph->add_output(), "y_" + std::to_string(initializers_num));
+
+    std::stringstream model_stream{model_proto.SerializeAsString()};
+    const auto model = ngraph::onnx_import::import_onnx_model(model_stream);
+
+    int64_t constants_num = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant)
+            continue;
+        ++constants_num;
+        const auto& names = constant->get_output_tensor(0).get_names();
+        ASSERT_EQ(names.size(), 1);
+        const auto i = std::stoll(names.begin()->substr(std::string("w_").size()));
+        ASSERT_EQ(constant->get_element_type(), ov::element::f32);
+        ASSERT_EQ(constant->get_shape(), ov::Shape{static_cast<size_t>(elements_num)});
+        const auto values = constant->cast_vector<float>();
+        for (int64_t j = 0; j < elements_num; ++j) {
+            ASSERT_EQ(values[j], expected_value(i, j)) << "initializer " << *names.begin() << " element " << j;
+        }
+    }
+    ASSERT_EQ(constants_num, initializers_num);
+}
@@ -5,9 +5,11 @@
 #include "decoder_proto.hpp"
 
 #include "attr_value.pb.h"
+#include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "openvino/frontend/tensorflow/special_types.hpp"
+#include "openvino/runtime/allocator.hpp"
 #include "types.pb.h"
 
 namespace ov {
@@ -30,6 +32,29 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
     return type_map;
 }
 
+/// Allocator placing a tensor into the already existing tensor_content bytes of a TensorProto,
+/// the GraphDef owning these bytes is kept alive for as long as the tensor exists
+class TensorContentAllocator : public ov::AllocatorImpl {
+public:
+    TensorContentAllocator(const std::string& tensor_content, std::shared_ptr<const ::tensorflow::GraphDef> graph_def)
+        : m_tensor_content(tensor_content),
+          m_graph_def(std::move(graph_def)) {}
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        return bytes <= m_tensor_content.size() ? const_cast<char*>(m_tensor_content.data()) : nullptr;
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment) override {}
+
+    bool is_equal(const AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    const std::string& m_tensor_content;
+    std::shared_ptr<const ::tensorflow::GraphDef> m_graph_def;
+};
+
 template <typename T>
 void extract_tensor_content(const std::string& tensor_content, ov::Tensor* values) {
     const auto tensor_content_size = tensor_content.size();
@@ -89,22 +114,22 @@ void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_p
 }  // namespace
 
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
+    const auto attr = decode_attribute_helper(name);
+    if (!attr) {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attr->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr->shape();
         if (tf_shape.unknown_rank()) {
             return ov::PartialShape::dynamic();
         }
@@ -117,8 +142,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attr->type())) {
+            return TYPE_MAP().at(attr->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -126,7 +151,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -178,7 +203,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attr->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -190,8 +215,16 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
+        const auto& tensor_content = tensor_proto.tensor_content();
+        if (!tensor_content.empty() && tensor_proto.has_tensor_shape() && m_graph_def &&
+            ov_type != ov::element::boolean &&
+            tensor_content.size() == shape_size(pshape.get_shape()) * ov_type.size()) {
+            // the tensor is a view of tensor_content, so large constants are not copied out of the GraphDef
+            return ov::Tensor(ov_type,
+                              pshape.get_shape(),
+                              ov::Allocator(std::make_shared<TensorContentAllocator>(tensor_content, m_graph_def)));
+        }
         ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
         if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
@@ -303,14 +336,10 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
-    } else {
-        return {};
-    }
+const ::tensorflow::AttrValue* DecoderProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    const auto it = attr_map.find(name);
+    return it != attr_map.end() ? &it->second : nullptr;
 }
 }  // namespace tensorflow
 }  // namespace frontend
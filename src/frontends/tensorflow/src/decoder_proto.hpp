@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "openvino/frontend/tensorflow/decoder.hpp"
 
 namespace tensorflow {
+class GraphDef;
 class NodeDef;
 class AttrValue;
 }  // namespace tensorflow
@@ -20,7 +22,11 @@ namespace tensorflow {
 
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
-    explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    /// \param graph_def  Owner of node_def. Tensors decoded from tensor_content attributes
+    ///                   reference the memory of the message and keep graph_def alive.
+    DecoderProto(const ::tensorflow::NodeDef* node_def, std::shared_ptr<const ::tensorflow::GraphDef> graph_def)
+        : m_node_def(node_def),
+          m_graph_def(std::move(graph_def)) {}
 
     ov::Any get_attribute(const std::string& name) const override;
 
@@ -35,8 +41,9 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    const ::tensorflow::AttrValue* decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<const ::tensorflow::GraphDef> m_graph_def;
 };
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,7 +4,9 @@
 
 #pragma once
 
-#include <fstream>
+#include <google/protobuf/arena.h>
+
+#include <limits>
 
 #include "decoder_proto.hpp"
 #include "graph.pb.h"
@@ -12,6 +14,7 @@
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/tensorflow/decoder.hpp"
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace frontend {
@@ -23,12 +26,26 @@ class GraphIteratorProto : public GraphIterator {
     std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
 
 public:
+    /// The model file is memory-mapped only for the time of parsing, the GraphDef and all of its
+    /// nested messages are allocated in a protobuf arena owned by m_graph_def
     template <typename T>
-    GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(std::make_shared<::tensorflow::GraphDef>()) {
-        std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
+    GraphIteratorProto(const std::basic_string<T>& path) {
+        std::shared_ptr<ov::MappedMemory> mapped_model;
+        try {
+            mapped_model = ov::load_mmap_object(path);
+        } catch (const std::runtime_error&) {
+            FRONT_END_GENERAL_CHECK(false, "Model file does not exist");
+        }
+        FRONT_END_GENERAL_CHECK(mapped_model->size() <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                                "Model cannot be parsed: protobuf messages larger than 2GB are not supported");
 
-        FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
-        FRONT_END_GENERAL_CHECK(m_graph_def->ParseFromIstream(&pb_stream), "Model cannot be parsed");
+        const auto arena = std::make_shared<google::protobuf::Arena>();
+        m_graph_def = std::shared_ptr<::tensorflow::GraphDef>{
+            arena,
+            google::protobuf::Arena::Create<::tensorflow::GraphDef>(arena.get())};
+        FRONT_END_GENERAL_CHECK(
+            m_graph_def->ParseFromArray(mapped_model->data(), static_cast<int>(mapped_model->size())),
+            "Model cannot be parsed");
 
         m_nodes.resize(m_graph_def->node_size());
         for (size_t i = 0; i < m_nodes.size(); ++i)
@@ -55,7 +72,7 @@ public:
 
     /// Return NodeContext for the current node that iterator points to
     std::shared_ptr<DecoderBase> get_decoder() const override {
-        return std::make_shared<DecoderProto>(m_nodes[node_index]);
+        return std::make_shared<DecoderProto>(m_nodes[node_index], m_graph_def);
     }
 };
 
@@ -4,6 +4,7 @@
 
 #include <openvino/frontend/exception.hpp>
 #include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
 
 #include "test_common.hpp"
 #include "tf_utils.hpp"
@@ -69,3 +70,24 @@ TEST(FrontEndConvertTrickyModels, model_with_output_shapes) {
         }
     }
 }
+
+TEST(FrontEndConvertTrickyModels, const_data_outlives_input_model) {
+    shared_ptr<Model> model;
+    try {
+        // the input model, the decoders and the parsed GraphDef are destroyed after the conversion,
+        // while the Constant created from tensor_content shares their memory
+        model = convert_model("model_with_const_content/model_with_const_content.pb");
+    } catch (std::exception& ex) {
+        ASSERT_TRUE(false) << ex.what();
+    }
+
+    size_t const_count = 0;
+    for (auto& node : model->get_ordered_ops()) {
+        if (auto constant = as_type_ptr<opset8::Constant>(node)) {
+            ASSERT_EQ(constant->get_shape(), (Shape{2, 3}));
+            ASSERT_EQ(constant->cast_vector<float>(), (std::vector<float>{1.f, 2.f, 3.f, 4.f, 5.f, 6.f}));
+            const_count++;
+        }
+    }
+    ASSERT_EQ(const_count, 1);
+}
@@ -0,0 +1,16 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+
+import numpy as np
+import tensorflow.compat.v1 as tf
+
+tf.reset_default_graph()
+
+with tf.Session() as sess:
+    x = tf.placeholder(dtype=tf.float32, shape=[2, 3], name='x')
+    const = tf.constant(np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float32), name='const')
+    tf.add(x, const, name="add")
+
+    tf.global_variables_initializer()
+    tf.io.write_graph(sess.graph, '.', 'model_with_const_content.pbtxt', as_text=True)
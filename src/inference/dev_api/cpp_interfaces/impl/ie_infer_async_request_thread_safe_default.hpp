@@ -14,6 +14,8 @@
 #include <utility>
 #include <vector>
 
+#include "cpp_interfaces/impl/ie_latency_statistics.hpp"
+#include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "threading/ie_immediate_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
@@ -67,6 +69,20 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
         IStreamsExecutor::Ptr _streamsExecutor;
     };
 
+    struct LatencyMeasurement {
+        InferLatencyStatistics::Ptr statistics;
+        InferLatencyStatistics::Clock::time_point start;
+        InferLatencyStatistics::Clock::time_point executionStart;
+    };
+
+    void StartLatencyMeasurement() {
+        auto network = _syncRequest->getPointerToExecutableNetworkInternal();
+        _latency = {network ? network->GetLatencyStatistics() : nullptr, {}, {}};
+        if (_latency.statistics) {
+            _latency.start = InferLatencyStatistics::Clock::now();
+        }
+    }
+
     template <typename F>
     void InferImpl(const F& f) {
         _syncRequest->checkBlobs();
@@ -101,6 +117,7 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
         }
         if (state != InferState::Stop) {
             try {
+                StartLatencyMeasurement();
                 f();
             } catch (...) {
                 _promise.set_exception(std::current_exception());
@@ -401,6 +418,10 @@ private:
                 std::exception_ptr currentException = nullptr;
                 auto& thisStage = *itStage;
                 auto itNextStage = itStage + 1;
+                if (_latency.statistics && _latency.executionStart == InferLatencyStatistics::Clock::time_point{}) {
+                    _latency.executionStart = InferLatencyStatistics::Clock::now();
+                    _latency.statistics->queueWait.record(_latency.executionStart - _latency.start);
+                }
                 try {
                     auto& stageTask = std::get<Stage_e::task>(thisStage);
                     IE_ASSERT(nullptr != stageTask);
@@ -416,7 +437,13 @@ private:
                 }
 
                 if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                    auto lastStageTask = [this, currentException]() mutable {
+                    // The request becomes idle before the callback call, so measurement state is copied to the task
+                    auto latency = _latency;
+                    if (latency.statistics) {
+                        latency.statistics->execution.record(InferLatencyStatistics::Clock::now() -
+                                                             latency.executionStart);
+                    }
+                    auto lastStageTask = [this, currentException, latency]() mutable {
                         auto promise = std::move(_promise);
                         Callback callback;
                         {
@@ -425,16 +452,24 @@ private:
                             std::swap(callback, _callback);
                         }
                         if (callback) {
+                            const auto callbackStart = InferLatencyStatistics::Clock::now();
                             try {
                                 callback(currentException);
                             } catch (...) {
                                 currentException = std::current_exception();
                             }
+                            if (latency.statistics) {
+                                latency.statistics->callback.record(InferLatencyStatistics::Clock::now() -
+                                                                    callbackStart);
+                            }
                             std::lock_guard<std::mutex> lock{_mutex};
                             if (!_callback) {
                                 std::swap(callback, _callback);
                             }
                         }
+                        if (latency.statistics) {
+                            latency.statistics->total.record(InferLatencyStatistics::Clock::now() - latency.start);
+                        }
                         if (nullptr == currentException) {
                             promise.set_value();
                         } else {
@@ -456,5 +491,6 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    LatencyMeasurement _latency;
 };
 }  // namespace InferenceEngine
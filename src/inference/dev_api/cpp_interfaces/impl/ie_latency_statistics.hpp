@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Latency histograms of inference request pipeline stages
+ * @file ie_latency_statistics.hpp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Lock-free histogram of durations with HDR-like log-linear buckets.
+ * Values below 2^SubBucketBits are counted exactly, larger values fall into buckets which
+ * relative width is 2^-(SubBucketBits-1), so a reported percentile differs from the exact one by about 3%
+ * at most for the default configuration. Recording is one relaxed atomic increment plus min/max updates.
+ * @ingroup ie_dev_api_async_infer_request_api
+ */
+class LatencyHistogram {
+public:
+    using Duration = std::chrono::nanoseconds;
+
+    /**
+     * @brief Adds a duration to the histogram, can be called concurrently from any thread
+     * @param duration A duration to record, negative values are counted as zero
+     */
+    void record(Duration duration) {
+        const uint64_t value = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0;
+        _counts[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        _total.fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+        auto min = _min.load(std::memory_order_relaxed);
+        while (value < min && !_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+        }
+        auto max = _max.load(std::memory_order_relaxed);
+        while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Summary of the histogram in milliseconds
+     * @return Map with `count`, `min`, `max`, `mean`, `p50`, `p90`, `p95`, `p99` and `p99.9` keys,
+     * only `count` is reported for an empty histogram
+     * @note Values recorded concurrently with the call may be partially taken into account
+     */
+    std::map<std::string, double> summary() const {
+        std::array<uint64_t, BucketsNum> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < BucketsNum; ++i) {
+            counts[i] = _counts[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        std::map<std::string, double> result{{"count", static_cast<double>(total)}};
+        if (total == 0) {
+            return result;
+        }
+        const auto min = _min.load(std::memory_order_relaxed);
+        const auto max = _max.load(std::memory_order_relaxed);
+        result["min"] = toMs(min);
+        result["max"] = toMs(max);
+        result["mean"] = toMs(_sum.load(std::memory_order_relaxed)) / _total.load(std::memory_order_relaxed);
+        static const std::array<std::pair<const char*, double>, 5> percentiles{
+            {{"p50", 0.5}, {"p90", 0.9}, {"p95", 0.95}, {"p99", 0.99}, {"p99.9", 0.999}}};
+        for (auto&& percentile : percentiles) {
+            // rank of the value in 1-based sorted order
+            const auto rank = static_cast<uint64_t>(std::ceil(percentile.second * total));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BucketsNum; ++i) {
+                seen += counts[i];
+                if (seen >= rank) {
+                    // middle of the bucket clamped by really observed values
+                    const auto value = (bucketLowest(i) + bucketHighest(i)) / 2;
+                    result[percentile.first] = toMs(std::min(std::max(value, min), max));
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    static constexpr unsigned SubBucketBits = 5;
+    static constexpr uint64_t SubBucketsNum = uint64_t{1} << SubBucketBits;
+    static constexpr uint64_t HalfSubBucketsNum = SubBucketsNum / 2;
+    static constexpr size_t BucketsNum = SubBucketsNum + (64 - SubBucketBits) * HalfSubBucketsNum;
+
+    static unsigned highestBit(uint64_t value) {
+        unsigned bit = 0;
+        for (unsigned shift = 32; shift > 0; shift /= 2) {
+            if (value >> shift) {
+                value >>= shift;
+                bit += shift;
+            }
+        }
+        return bit;
+    }
+
+    // Values below SubBucketsNum have own buckets, larger values are grouped by the highest bit
+    // and then by the next SubBucketBits - 1 bits
+    static size_t bucketIndex(uint64_t value) {
+        if (value < SubBucketsNum) {
+            return static_cast<size_t>(value);
+        }
+        const auto shift = highestBit(value) - SubBucketBits + 1;
+        return static_cast<size_t>(SubBucketsNum + (shift - 1) * HalfSubBucketsNum + (value >> shift) -
+                                   HalfSubBucketsNum);
+    }
+
+    static uint64_t bucketLowest(size_t index) {
+        if (index < SubBucketsNum) {
+            return index;
+        }
+        const auto shift = (index - SubBucketsNum) / HalfSubBucketsNum + 1;
+        const auto mantissa = (index - SubBucketsNum) % HalfSubBucketsNum + HalfSubBucketsNum;
+        return static_cast<uint64_t>(mantissa) << shift;
+    }
+
+    static uint64_t bucketHighest(size_t index) {
+        if (index < SubBucketsNum) {
+            return index;
+        }
+        const auto shift = (index - SubBucketsNum) / HalfSubBucketsNum + 1;
+        return bucketLowest(index) + ((uint64_t{1} << shift) - 1);
+    }
+
+    static double toMs(uint64_t ns) {
+        return static_cast<double>(ns) / 1000000.0;
+    }
+
+    std::array<std::atomic<uint64_t>, BucketsNum> _counts{};
+    std::atomic<uint64_t> _total{0};
+    std::atomic<uint64_t> _sum{0};
+    std::atomic<uint64_t> _min{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> _max{0};
+};
+
+/**
+ * @brief Latency histograms of inference request stages shared by all the requests of an executable network
+ * @ingroup ie_dev_api_async_infer_request_api
+ */
+struct InferLatencyStatistics {
+    using Ptr = std::shared_ptr<InferLatencyStatistics>;
+    using Clock = std::chrono::steady_clock;
+
+    LatencyHistogram queueWait;   //!< From StartAsync or Infer call to the start of the first pipeline stage
+    LatencyHistogram preprocess;  //!< Input preprocessing (resize, color conversion) done by the request
+    LatencyHistogram execution;   //!< From the start of the first pipeline stage to the end of the last one,
+                                  //!< includes preprocessing
+    LatencyHistogram callback;    //!< User callback
+    LatencyHistogram total;       //!< From StartAsync or Infer call to the request completion
+
+    /**
+     * @brief Summaries of all the stages
+     * @return Map from stage name to LatencyHistogram::summary
+     */
+    std::map<std::string, std::map<std::string, double>> summary() const {
+        return {{"queue_wait", queueWait.summary()},
+                {"preprocess", preprocess.summary()},
+                {"execution", execution.summary()},
+                {"callback", callback.summary()},
+                {"total", total.summary()}};
+    }
+};
+
+}  // namespace InferenceEngine
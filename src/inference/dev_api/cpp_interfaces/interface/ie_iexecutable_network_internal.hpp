@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -30,6 +31,7 @@ class IInferencePlugin;
 class IInferRequestInternal;
 class RemoteContext;
 class IVariableStateInternal;
+struct InferLatencyStatistics;
 
 /**
  * @interface IExecutableNetworkInternal
@@ -155,6 +157,20 @@ public:
      */
     virtual std::shared_ptr<RemoteContext> GetContext() const;
 
+    /**
+     * @brief Enables or disables collection of latency statistics by inference requests of the network
+     * @param enabled If `true`, statistics are collected to the existing histograms or to new ones, if collection
+     * was disabled. If `false`, collected statistics are dropped
+     * @note Can be called concurrently with inference, the change affects requests started after the call
+     */
+    void SetLatencyStatisticsEnabled(bool enabled);
+
+    /**
+     * @brief Gets latency histograms shared by all inference requests of the network
+     * @return A shared pointer to statistics or nullptr if collection is disabled
+     */
+    std::shared_ptr<InferLatencyStatistics> GetLatencyStatistics() const;
+
 protected:
     virtual ~IExecutableNetworkInternal() = default;
 
@@ -196,6 +212,11 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     std::shared_ptr<void> _so;
+
+private:
+    // checked by every inference request before _latencyStatistics, which is accessed with a lock
+    std::atomic<bool> _latencyStatisticsEnabled{false};
+    std::shared_ptr<InferLatencyStatistics> _latencyStatistics;
 };
 
 /**
@@ -42,5 +42,38 @@ DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
 DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
 
+/**
+ * @brief The name for defining if FP16 compressed weights of fully connected layers are kept in FP16 on CPU
+ *
+ * Models compressed to FP16 store weights as FP16 constants with decompression Converts. By default CPU plugin
+ * folds such Converts and keeps FP32 copies of the weights. With this option the weights of fully connected
+ * layers stay in FP16 and are converted to FP32 during the inference, which halves the memory they occupy
+ * at the cost of slower execution of these layers. Only the layers with up to 16 input rows (e.g. the token by token
+ * generation with batch 1) keep FP16 weights, the others are executed with FP32 weights.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(KEEP_FP16_WEIGHTS);
+
+/**
+ * @brief The name for defining if hardware performance counters are collected per layer on CPU
+ *
+ * Works together with PluginConfigParams::KEY_PERF_COUNT. CPU cycles, retired instructions and last level cache
+ * misses of the thread executing the graph are sampled by the Linux perf_event interface around each layer execution
+ * and reported in the runtime (execution) graph. The totals of all the threads are reported per inference in the trace
+ * file (see KEY_CPU_PERF_TRACE_FILE). The option is ignored if the counters are not available on the system.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(HW_PERF_COUNTERS);
+
+/**
+ * @brief The name for defining the file the layers execution trace is written to in Chrome trace JSON format
+ *
+ * Works together with PluginConfigParams::KEY_PERF_COUNT. The file is written when the compiled model is destroyed.
+ * Empty value (default) disables the trace.
+ */
+DECLARE_CPU_CONFIG_KEY(PERF_TRACE_FILE);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
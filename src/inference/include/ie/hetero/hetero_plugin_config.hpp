@@ -34,5 +34,16 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of subgraphs.
+ * When enabled, every subgraph is a stage of the pipeline with its own executor, and subgraphs are compiled without
+ * CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS). Consecutive infer requests overlap across subgraphs: while one request
+ * executes the second subgraph, the next one may already execute the first subgraph. The optimal number of infer
+ * requests reported by the compiled network becomes the sum of the optimal numbers of all subgraphs.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES).
+ * CONFIG_VALUE(YES) can't be combined with CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS) set to CONFIG_VALUE(YES).
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINED_EXECUTION);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -284,6 +285,39 @@ public:
         return compile_model(model, context, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Creates a compiled model from a source model object on the background threads of the Core.
+     *
+     * The function returns immediately, so the calling thread (e.g. the one serving requests with
+     * previous version of the model) is not blocked while the model is transformed and compiled.
+     * Exceptions thrown during compilation are rethrown by std::future::get.
+     * @note The number of pending compilations is limited: if the limit is reached, the function blocks
+     * until one of them is finished. Destructor of returned std::future doesn't wait for compilation.
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future with compiled model object.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Reads and compiles a model from IR / ONNX / PDPD file on the background threads of the Core.
+     *
+     * @note The number of pending compilations is limited: if the limit is reached, the function blocks
+     * until one of them is finished. Destructor of returned std::future doesn't wait for compilation.
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future with compiled model object.
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
     /**
      * @deprecated This method is deprecated. Please use other Core::add_extension methods.
      * @brief Registers OpenVINO 1.0 extension to a Core object.
@@ -49,5 +49,41 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether FP16 compressed weights of fully connected layers are kept in FP16.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * FP16 weights are converted to FP32 during the inference, so the memory occupied by the weights is halved at the
+ * cost of slower execution of these layers. Only the layers with up to 16 input rows keep FP16 weights.
+ * The following code enables FP16 weights
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::keep_fp16_weights(true));
+ * @endcode
+ */
+static constexpr Property<bool> keep_fp16_weights{"CPU_KEEP_FP16_WEIGHTS"};
+
+/**
+ * @brief This property defines whether hardware performance counters are collected per node.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Works together with ov::enable_profiling. CPU cycles, instructions and last level cache misses of each node measured
+ * on the thread executing the graph are reported in the runtime model, the totals of all the threads are reported per
+ * inference in the trace file (see ov::intel_cpu::perf_trace_file). The following code enables hardware counters
+ *
+ * @code
+ * ie.set_property(ov::enable_profiling(true), ov::intel_cpu::hw_perf_counters(true));
+ * @endcode
+ */
+static constexpr Property<bool> hw_perf_counters{"CPU_HW_PERF_COUNTERS"};
+
+/**
+ * @brief This property defines the file the nodes execution trace is written to in Chrome trace JSON format.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Works together with ov::enable_profiling. The file is written when the compiled model is destroyed.
+ */
+static constexpr Property<std::string> perf_trace_file{"CPU_PERF_TRACE_FILE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -517,6 +517,40 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to share compiled models between compile_model calls of one core
+ * value type: boolean
+ *   - True compile_model returns already existing compiled model, if it is still alive and was compiled
+ *     with the same model, device and configuration
+ *   - False compile_model always creates new compiled model (default)
+ * @note Works only when models caching is enabled via ov::cache_dir
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> share_compiled_models{"SHARE_COMPILED_MODELS"};
+
+/**
+ * @brief Read-write property to enable collection of latency statistics by inference requests of a compiled model
+ * value type: boolean
+ *   - True inference requests record durations of their stages to histograms shared by the compiled model
+ *   - False statistics are not collected, already collected statistics are dropped (default)
+ * @note The property is set via ov::CompiledModel::set_property and is handled by the runtime for all devices
+ * which inference requests are based on the default asynchronous pipeline
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_latency_statistics{"ENABLE_LATENCY_STATISTICS"};
+
+/**
+ * @brief Read-only property to get latency statistics of a compiled model collected since
+ * ov::enable_latency_statistics was set to true
+ * value type: map from a stage name to a map of statistics in milliseconds
+ *   - stages: "queue_wait", "preprocess", "execution", "callback", "total"
+ *   - statistics: "count", "min", "max", "mean", "p50", "p90", "p95", "p99", "p99.9"
+ * Percentiles are computed from log-linear histograms and have about 3% relative precision
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::map<std::string, std::map<std::string, double>>, PropertyMutability::RO>
+    latency_statistics{"LATENCY_STATISTICS"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -6,6 +6,7 @@
 
 #include "any_copy.hpp"
 #include "cpp/exception2status.hpp"
+#include "cpp_interfaces/impl/ie_latency_statistics.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "ie_common.h"
 #include "ie_executable_network_base.hpp"
@@ -209,7 +210,20 @@ void CompiledModel::export_model(std::ostream& networkModel) {
 }
 
 void CompiledModel::set_property(const AnyMap& config) {
-    OV_EXEC_NET_CALL_STATEMENT(_impl->SetConfig(config));
+    OV_EXEC_NET_CALL_STATEMENT({
+        auto it = config.find(ov::enable_latency_statistics.name());
+        if (it == config.end()) {
+            _impl->SetConfig(config);
+            return;
+        }
+        // latency statistics are collected by the runtime, so the property is not passed to the plugin
+        _impl->SetLatencyStatisticsEnabled(it->second.as<bool>());
+        auto pluginConfig = config;
+        pluginConfig.erase(ov::enable_latency_statistics.name());
+        if (!pluginConfig.empty()) {
+            _impl->SetConfig(pluginConfig);
+        }
+    });
 }
 
 Any CompiledModel::get_property(const std::string& name) const {
@@ -242,6 +256,13 @@ Any CompiledModel::get_property(const std::string& name) const {
                 return supported_properties;
             }
         }
+        if (ov::enable_latency_statistics == name) {
+            return decltype(ov::enable_latency_statistics)::value_type{_impl->GetLatencyStatistics() != nullptr};
+        }
+        if (ov::latency_statistics == name) {
+            auto statistics = _impl->GetLatencyStatistics();
+            return statistics ? statistics->summary() : decltype(ov::latency_statistics)::value_type{};
+        }
         try {
             return {_impl->GetMetric(name), {_so}};
         } catch (ie::Exception&) {
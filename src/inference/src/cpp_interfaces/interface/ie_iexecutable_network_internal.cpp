@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "cpp/ie_cnn_network.h"
+#include "cpp_interfaces/impl/ie_latency_statistics.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
@@ -111,6 +112,29 @@ std::shared_ptr<RemoteContext> IExecutableNetworkInternal::GetContext() const {
     IE_THROW(NotImplemented);
 }
 
+void IExecutableNetworkInternal::SetLatencyStatisticsEnabled(bool enabled) {
+    if (!enabled) {
+        _latencyStatisticsEnabled.store(false, std::memory_order_release);
+        std::atomic_store(&_latencyStatistics, std::shared_ptr<InferLatencyStatistics>{});
+    } else {
+        if (!std::atomic_load(&_latencyStatistics)) {
+            std::shared_ptr<InferLatencyStatistics> expected;
+            std::atomic_compare_exchange_strong(&_latencyStatistics,
+                                                &expected,
+                                                std::make_shared<InferLatencyStatistics>());
+        }
+        _latencyStatisticsEnabled.store(true, std::memory_order_release);
+    }
+}
+
+std::shared_ptr<InferLatencyStatistics> IExecutableNetworkInternal::GetLatencyStatistics() const {
+    // the common case of disabled statistics doesn't take the lock of the atomic shared pointer
+    if (!_latencyStatisticsEnabled.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    return std::atomic_load(&_latencyStatistics);
+}
+
 std::shared_ptr<IInferRequestInternal> IExecutableNetworkInternal::CreateInferRequestImpl(
     InputsDataMap networkInputs,
     OutputsDataMap networkOutputs) {
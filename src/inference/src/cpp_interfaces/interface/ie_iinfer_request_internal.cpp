@@ -10,6 +10,7 @@
 #include <openvino/core/partial_shape.hpp>
 #include <string>
 
+#include "cpp_interfaces/impl/ie_latency_statistics.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "cpp_interfaces/plugin_itt.hpp"
@@ -454,6 +455,11 @@ void IInferRequestInternal::SetCallback(Callback callback) {
 }
 
 void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial) {
+    if (_preProcData.empty()) {
+        return;
+    }
+    auto latencyStatistics = _exeNetwork ? _exeNetwork->GetLatencyStatistics() : nullptr;
+    const auto start = InferLatencyStatistics::Clock::now();
     for (auto& input : preprocessedBlobs) {
         // If there is a pre-process entry for an input then it must be pre-processed
         // using preconfigured resize algorithm.
@@ -462,6 +468,9 @@ void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& prep
             it->second->execute(input.second, _networkInputs[input.first]->getPreProcess(), serial, m_curBatch);
         }
     }
+    if (latencyStatistics) {
+        latencyStatistics->preprocess.record(InferLatencyStatistics::Clock::now() - start);
+    }
 }
 
 bool IInferRequestInternal::findInputAndOutputBlobByName(const std::string& name,
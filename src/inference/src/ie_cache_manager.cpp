@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief RAII holder of an exclusive advisory lock on a file
+ * If the file can't be created or locked (e.g. read-only cache directory), nothing is locked
+ * and cache entry is used without cross-process protection as before
+ */
+class FileLock {
+public:
+    explicit FileLock(const std::string& path) {
+#ifdef _WIN32
+        m_handle = CreateFileA(path.c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            if (!LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+                CloseHandle(m_handle);
+                m_handle = INVALID_HANDLE_VALUE;
+            }
+        }
+#else
+        m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0666);
+        if (m_fd != -1) {
+            int res = 0;
+            do {
+                res = ::flock(m_fd, LOCK_EX);
+            } while (res == -1 && errno == EINTR);
+            if (res != 0) {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+        }
+#endif
+    }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    ~FileLock() {
+#ifdef _WIN32
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            CloseHandle(m_handle);
+        }
+#else
+        if (m_fd != -1) {
+            ::flock(m_fd, LOCK_UN);
+            ::close(m_fd);
+        }
+#endif
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+}  // namespace
+
+std::shared_ptr<void> FileStorageCacheManager::lockCacheEntry(const std::string& id) {
+    return std::make_shared<FileLock>(getLockFile(id));
+}
+
+}  // namespace InferenceEngine
@@ -70,6 +70,20 @@ public:
      * @param id Id of cache (hash of the network)
      */
     virtual void removeCacheEntry(const std::string& id) = 0;
+
+    /**
+     * @brief Callback when Inference Engine intends to get exclusive access to cache entry
+     *
+     * Is used to protect cache entry from being read and written by several processes at once,
+     * so only one of them compiles the network while others wait and import the written blob.
+     * Default implementation does not lock anything
+     *
+     * @param id Id of cache (hash of the network)
+     * @return RAII object, cache entry is unlocked on its destruction
+     */
+    virtual std::shared_ptr<void> lockCacheEntry(const std::string& id) {
+        return nullptr;
+    }
 };
 
 /**
@@ -85,6 +99,10 @@ class FileStorageCacheManager final : public ICacheManager {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    std::string getLockFile(const std::string& blobHash) const {
+        return FileUtils::makePath(m_cachePath, blobHash + ".lock");
+    }
+
 public:
     /**
      * @brief Constructor
@@ -117,6 +135,12 @@ private:
         if (FileUtils::fileExist(blobFileName))
             std::remove(blobFileName.c_str());
     }
+
+    /**
+     * @brief Takes an advisory lock of '<id>.lock' file in cache directory
+     * The lock file is not removed on unlock to avoid races with processes waiting for it
+     */
+    std::shared_ptr<void> lockCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
@@ -6,6 +6,8 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -246,6 +248,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         bool flag_allow_auto_batching = true;
+        std::atomic_bool flag_share_compiled_models{false};
 
         void setAndUpdate(ov::AnyMap& config) {
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
@@ -271,6 +274,12 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 flag_allow_auto_batching = flag;
                 config.erase(it);
             }
+
+            it = config.find(ov::share_compiled_models.name());
+            if (it != config.end()) {
+                flag_share_compiled_models = it->second.as<bool>();
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
@@ -346,6 +355,43 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     ie::CacheGuard cacheGuard;
 
+    // Compiled models which are still alive, identified by cache hash. Is filled only
+    // when ov::share_compiled_models is enabled, entries don't own compiled models
+    struct SharedCompiledModel {
+        std::weak_ptr<ie::IExecutableNetworkInternal> _ptr;
+        std::shared_ptr<void> _so;
+    };
+    std::mutex sharedCompiledModelsMutex;
+    std::unordered_map<std::string, SharedCompiledModel> sharedCompiledModels;
+
+    bool GetSharedCompiledModel(const std::string& blobId, ov::SoPtr<ie::IExecutableNetworkInternal>& execNetwork) {
+        if (!coreConfig.flag_share_compiled_models)
+            return false;
+        std::lock_guard<std::mutex> lock(sharedCompiledModelsMutex);
+        auto it = sharedCompiledModels.find(blobId);
+        if (it == sharedCompiledModels.end())
+            return false;
+        auto ptr = it->second._ptr.lock();
+        if (!ptr) {
+            sharedCompiledModels.erase(it);
+            return false;
+        }
+        execNetwork = {ptr, it->second._so};
+        return true;
+    }
+
+    void AddSharedCompiledModel(const std::string& blobId,
+                                const ov::SoPtr<ie::IExecutableNetworkInternal>& execNetwork) {
+        if (!coreConfig.flag_share_compiled_models || !execNetwork._ptr)
+            return;
+        std::lock_guard<std::mutex> lock(sharedCompiledModelsMutex);
+        // drop entries of already destroyed models
+        for (auto it = sharedCompiledModels.begin(); it != sharedCompiledModels.end();) {
+            it = it->second._ptr.expired() ? sharedCompiledModels.erase(it) : std::next(it);
+        }
+        sharedCompiledModels[blobId] = {execNetwork._ptr, execNetwork._so};
+    }
+
     struct PluginDescriptor {
         ov::util::FilePath libraryLocation;
         ov::AnyMap defaultConfig;
@@ -373,6 +419,16 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     };
 
     ExecutorManager::Ptr executorManagerPtr;
+
+    // compile_model_async tasks run on the executor of the core and at most
+    // compileModelMaxPendingTasks of them may be queued or running at once
+    static constexpr int compileModelStreams = 2;
+    static constexpr size_t compileModelMaxPendingTasks = 16;
+    ie::ITaskExecutor::Ptr compileModelExecutor;
+    std::mutex compileModelMutex;
+    std::condition_variable compileModelCondVar;
+    size_t compileModelPendingTasks = 0;
+
     mutable std::unordered_set<std::string> opsetNames;
     // TODO: make extensions to be optional with conditional compilation
     mutable std::vector<ie::IExtensionPtr> extensions;
@@ -556,6 +612,38 @@ public:
 
     ~CoreImpl() override = default;
 
+    /**
+     * @brief Runs the compile_model_async task on the executor of the core.
+     * The executor is created on the first call. If the queue of the pending tasks is full, the caller is blocked
+     * until one of the tasks is finished.
+     * @param task A task which must not throw, e.g. std::packaged_task stores the exception in its future
+     */
+    void RunCompileModelTask(ie::Task task) {
+        ie::ITaskExecutor::Ptr executor;
+        {
+            std::unique_lock<std::mutex> lock(compileModelMutex);
+            compileModelCondVar.wait(lock, [&] {
+                return compileModelPendingTasks < compileModelMaxPendingTasks;
+            });
+            ++compileModelPendingTasks;
+            if (!compileModelExecutor) {
+                // executor manager keeps the executor, so it isn't joined from its own thread
+                // when the task holds the last reference to the core
+                compileModelExecutor = executorManagerPtr->getIdleCPUStreamsExecutor(
+                    ie::IStreamsExecutor::Config{"CompileModelAsync", compileModelStreams});
+            }
+            executor = compileModelExecutor;
+        }
+        executor->run([this, task] {
+            task();
+            {
+                std::lock_guard<std::mutex> lock(compileModelMutex);
+                --compileModelPendingTasks;
+            }
+            compileModelCondVar.notify_one();
+        });
+    }
+
     /**
      * @brief Register plugins for devices which are located in .xml configuration file.
      * @note The function supports UNICODE path
@@ -714,6 +802,7 @@ public:
             cacheContent.blobId = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
             bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(cacheContent.blobId);
+            auto fileLock = cacheManager->lockCacheEntry(cacheContent.blobId);
             res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, context, loadedFromCache);
             if (!loadedFromCache) {
                 res = compile_model_impl(network, plugin, parsed._config, context, cacheContent);
@@ -833,6 +922,10 @@ public:
             cacheContent.blobId = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
             bool loadedFromCache = false;
             auto lock = cacheGuard.getHashLock(cacheContent.blobId);
+            if (GetSharedCompiledModel(cacheContent.blobId, res)) {
+                return {res._ptr, res._so};
+            }
+            auto fileLock = cacheManager->lockCacheEntry(cacheContent.blobId);
             res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache);
             if (!loadedFromCache) {
                 res = compile_model_impl(network, plugin, parsed._config, nullptr, cacheContent, forceDisableCache);
@@ -840,6 +933,7 @@ public:
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
             }
+            AddSharedCompiledModel(cacheContent.blobId, res);
         } else {
             res = compile_model_impl(network, plugin, parsed._config, nullptr, cacheContent, forceDisableCache);
         }
@@ -862,6 +956,10 @@ public:
             bool loadedFromCache = false;
             cacheContent.blobId = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
             auto lock = cacheGuard.getHashLock(cacheContent.blobId);
+            if (GetSharedCompiledModel(cacheContent.blobId, res)) {
+                return {res._ptr, res._so};
+            }
+            auto fileLock = cacheManager->lockCacheEntry(cacheContent.blobId);
             res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache);
             if (!loadedFromCache) {
                 auto cnnNetwork = ReadNetwork(modelPath, std::string());
@@ -870,6 +968,7 @@ public:
                 }
                 res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent);
             }
+            AddSharedCompiledModel(cacheContent.blobId, res);
         } else if (cacheManager) {
             // TODO: 'validation' for dynamic API doesn't work for this case, as it affects a lot of plugin API
             res = plugin.compile_model(modelPath, parsed._config);
@@ -1024,6 +1123,9 @@ public:
         } else if (name == ov::hint::allow_auto_batching.name()) {
             const auto flag = coreConfig.flag_allow_auto_batching;
             return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+        } else if (name == ov::share_compiled_models.name()) {
+            const bool flag = coreConfig.flag_share_compiled_models;
+            return decltype(ov::share_compiled_models)::value_type(flag);
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
@@ -2013,6 +2115,47 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                    const std::string& deviceName,
+                                                    const AnyMap& config) {
+    // Task holds a reference to core implementation, so Core object can be destroyed before the task is finished
+    auto impl = _impl;
+    auto properties = any_copy(flatten_sub_properties(deviceName, config));
+    auto task = std::make_shared<std::packaged_task<CompiledModel()>>(
+        [impl, model, deviceName, properties]() -> CompiledModel {
+            OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::compile_model_async");
+            OV_CORE_CALL_STATEMENT({
+                auto exec = impl->LoadNetwork(toCNN(model), deviceName, properties);
+                return {exec._ptr, exec._so};
+            });
+        });
+    auto future = task->get_future();
+    _impl->RunCompileModelTask([task] {
+        (*task)();
+    });
+    return future;
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& modelPath,
+                                                    const std::string& deviceName,
+                                                    const AnyMap& config) {
+    auto impl = _impl;
+    auto properties = any_copy(flatten_sub_properties(deviceName, config));
+    auto task = std::make_shared<std::packaged_task<CompiledModel()>>(
+        [impl, modelPath, deviceName, properties]() -> CompiledModel {
+            OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::compile_model_async");
+            OV_CORE_CALL_STATEMENT({
+                auto exec = impl->LoadNetwork(modelPath, deviceName, properties);
+                return {exec._ptr, exec._so};
+            });
+        });
+    auto future = task->get_future();
+    _impl->RunCompileModelTask([task] {
+        (*task)();
+    });
+    return future;
+}
+
 void Core::add_extension(const ie::IExtensionPtr& extension) {
     OV_CORE_CALL_STATEMENT(_impl->AddExtension(extension););
 }
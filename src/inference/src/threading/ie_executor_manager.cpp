@@ -5,6 +5,7 @@
 #include "threading/ie_executor_manager.hpp"
 
 #include "ie_parallel.hpp"
+#include "parallel_executor.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
 #    if (TBB_INTERFACE_VERSION < 12000)
@@ -14,6 +15,7 @@
 #    endif
 #endif
 
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -23,6 +25,7 @@ namespace InferenceEngine {
 namespace {
 class ExecutorManagerImpl : public ExecutorManager {
 public:
+    ExecutorManagerImpl();
     ~ExecutorManagerImpl();
     ITaskExecutor::Ptr getExecutor(const std::string& id) override;
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) override;
@@ -52,7 +55,32 @@ private:
 
 }  // namespace
 
+ExecutorManagerImpl::ExecutorManagerImpl() {
+    // the parallel work of the core components (constant folding, frontends) shares the threads with the plugins
+    ov::threading::ParallelExecutor executor;
+    executor.get_max_threads = [] {
+        return static_cast<size_t>(parallel_get_max_threads());
+    };
+    executor.run = [](size_t nthr, const std::function<void(size_t, size_t)>& func) {
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int team) {
+            try {
+                func(static_cast<size_t>(ithr), static_cast<size_t>(team));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        });
+        if (error)
+            std::rethrow_exception(error);
+    };
+    ov::threading::set_parallel_executor(std::move(executor));
+}
+
 ExecutorManagerImpl::~ExecutorManagerImpl() {
+    ov::threading::set_parallel_executor({});
     resetTbb();
 }
 
@@ -7,6 +7,8 @@
 #include <memory>
 #include <utility>
 
+#include "itt.hpp"
+
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
 
@@ -17,6 +19,18 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
+        auto& stageExecutor = _heteroInferRequest->_inferRequests[requestId]._stageExecutor;
+        if (stageExecutor) {
+            // pipelined execution: the subgraph is inferred on its own stage executor, so the next request can
+            // enter this stage while the current one is inferred by the next subgraph
+            _pipeline.emplace_back(stageExecutor, [this, requestId] {
+                auto& desc = _heteroInferRequest->_inferRequests[requestId];
+                OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
+                desc._request->Infer();
+            });
+            continue;
+        }
+
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
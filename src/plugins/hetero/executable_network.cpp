@@ -36,6 +36,7 @@
 #include "ie_plugin_config.hpp"
 #include "ie_algorithm.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "threading/ie_executor_manager.hpp"
 #include "plugin.hpp"
 #include <ie_algorithm.hpp>
 
@@ -516,6 +517,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitStageExecutors();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -669,6 +671,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     // save state
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
+    InitStageExecutors();
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
 }
 
@@ -810,6 +813,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._stageExecutor = subnetwork._stageExecutor;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
@@ -823,12 +827,29 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._stageExecutor = subnetwork._stageExecutor;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
 }
 
+bool HeteroExecutableNetwork::isPipelined() const {
+    auto it = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+    return it != _config.end() && it->second == YES;
+}
+
+void HeteroExecutableNetwork::InitStageExecutors() {
+    if (!isPipelined())
+        return;
+    // every subgraph gets a single stream executor: a request enters the next stage as soon as the subgraph
+    // is inferred, so the stages of the consecutive requests overlap but keep the order of the requests
+    for (std::size_t id = 0; id < _networks.size(); ++id) {
+        _networks[id]._stageExecutor = _heteroPlugin->executorManager()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"HeteroStage" + std::to_string(id)});
+    }
+}
+
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<HeteroAsyncInferRequest>();
 }
@@ -849,6 +870,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION)) {
+        result = isPipelined();
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -930,6 +953,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -952,9 +976,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
         unsigned int value = 0u;
+        const bool pipelined = isPipelined();
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto subnetworkValue =
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            // in the pipelined mode every subgraph should have its own set of requests in flight
+            value = pipelined ? value + subnetworkValue : std::max(value, subnetworkValue);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (name == ov::execution_devices) {
@@ -65,11 +65,15 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    bool isPipelined() const;
+    void InitStageExecutors();
 
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal _network;
+        // runs the subgraph of all the requests one after another in the pipelined mode
+        InferenceEngine::ITaskExecutor::Ptr _stageExecutor;
     };
 
     std::vector<NetworkDesc> _networks;
@@ -12,6 +12,7 @@
 #include <memory>
 #include <openvino/itt.hpp>
 #include <string>
+#include <threading/ie_itask_executor.hpp>
 #include <unordered_map>
 #include <vector>
 
@@ -24,6 +25,7 @@ public:
     struct SubRequestDesc {
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
+        InferenceEngine::ITaskExecutor::Ptr _stageExecutor;
         openvino::itt::handle_t _profilingTask;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
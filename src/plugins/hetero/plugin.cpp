@@ -25,8 +25,8 @@ using namespace HeteroPlugin;
 
 Engine::Engine() {
     _pluginName = "HETERO";
-    _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = NO;
 }
 
 namespace {
@@ -35,11 +35,23 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
     for (auto&& kvp : local) {
         config[kvp.first] = kvp.second;
     }
+
+    // subgraphs share an exclusive executor of the device unless they are pipelined on the stage executors
+    auto pipelined = config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+    const bool isPipelined = pipelined != config.end() && pipelined->second == YES;
+    auto exclusive = config.find(KEY_EXCLUSIVE_ASYNC_REQUESTS);
+    if (exclusive == config.end()) {
+        config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = isPipelined ? NO : YES;
+    } else if (isPipelined && exclusive->second == YES) {
+        IE_THROW() << HETERO_CONFIG_KEY(PIPELINED_EXECUTION) << " can't be used together with "
+                   << KEY_EXCLUSIVE_ASYNC_REQUESTS << " set to YES";
+    }
     return config;
 }
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -214,11 +226,11 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
-    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
-        auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION)) {
+        auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
-        bool dump = it->second == YES;
-        return {dump};
+        bool value = it->second == YES;
+        return {value};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <functional>
+#include <mutex>
 #include "lru_cache.h"
 
 namespace ov {
@@ -55,19 +56,29 @@ public:
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
+        ValType retVal;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            retVal = _impl.get(key);
+        }
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            // the builder is called without the lock, so the values for different keys may be created concurrently
             retVal = builder(key);
-            if (retVal != retEmpty)
+            if (retVal != retEmpty) {
+                std::lock_guard<std::mutex> lock(_mutex);
                 _impl.put(key, retVal);
+            }
         }
         return {retVal, retStatus};
     }
 
 public:
     ImplType _impl;
+
+private:
+    std::mutex _mutex;
 };
 
 }   // namespace intel_cpu
@@ -88,6 +88,24 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS) {
+            if (val == PluginConfigParams::YES)
+                keepFP16Weights = true;
+            else if (val == PluginConfigParams::NO)
+                keepFP16Weights = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS) {
+            if (val == PluginConfigParams::YES)
+                collectHwPerfCounters = true;
+            else if (val == PluginConfigParams::NO)
+                collectHwPerfCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_PERF_TRACE_FILE) {
+            perfTraceFile = val;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -233,6 +251,15 @@ void Config::updateProperties() {
     } else {
         _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
     }
+    if (keepFP16Weights)
+        _config.insert({ CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::YES });
+    else
+        _config.insert({ CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::NO });
+    if (collectHwPerfCounters)
+        _config.insert({ CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::YES });
+    else
+        _config.insert({ CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::NO });
+    _config.insert({ CPUConfigParams::KEY_CPU_PERF_TRACE_FILE, perfTraceFile });
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT, perfHintsConfig.ovPerfHint });
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
@@ -30,11 +30,14 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
+    std::string perfTraceFile = "";
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
+    bool keepFP16Weights = false;
     size_t rtCacheCapacity = 5000ul;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,6 +17,7 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    std::mutex mutex;
 
 public:
     DnnlScratchPad(dnnl::engine eng) : eng(eng) {
@@ -23,6 +25,8 @@ public:
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        // the shared manager is resized on creation, nodes may create primitives in parallel
+        std::lock_guard<std::mutex> lock(mutex);
         auto mem = std::make_shared<Memory>(eng);
         mem->Create(md, mgrPtr);
         return mem;
@@ -26,6 +26,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -312,6 +313,9 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::keep_fp16_weights.name()),
+            RO_property(ov::intel_cpu::hw_perf_counters.name()),
+            RO_property(ov::intel_cpu::perf_trace_file.name()),
         };
     }
 
@@ -354,6 +358,14 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::keep_fp16_weights) {
+        const bool keepFP16Weights = config.keepFP16Weights;
+        return decltype(ov::intel_cpu::keep_fp16_weights)::value_type(keepFP16Weights);
+    } else if (name == ov::intel_cpu::hw_perf_counters) {
+        const bool hwPerfCounters = config.collectHwPerfCounters;
+        return decltype(ov::intel_cpu::hw_perf_counters)::value_type(hwPerfCounters);
+    } else if (name == ov::intel_cpu::perf_trace_file) {
+        return decltype(ov::intel_cpu::perf_trace_file)::value_type(config.perfTraceFile);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
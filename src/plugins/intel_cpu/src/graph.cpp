@@ -17,6 +17,7 @@
 #include "graph.h"
 #include "graph_dumper.h"
 #include "graph_optimizer.h"
+#include "layout_planner.h"
 #include "dnnl_extension_utils.h"
 #include "extension_mngr.h"
 #include "memory_solver.hpp"
@@ -29,6 +30,7 @@
 #include "nodes/fullyconnected.h"
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -71,6 +73,8 @@ dnnl::engine Graph::eng(dnnl::engine::kind::cpu, 0);
 
 Graph::~Graph() {
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
+    if (perfTrace)
+        perfTrace->addEvents(perfTraceSourceId, perfTraceEvents);
 }
 
 template<typename NET>
@@ -91,6 +95,8 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
 
     InitGraph();
 
+    InitProfiling();
+
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
 }
 
@@ -406,6 +412,8 @@ void Graph::InitGraph() {
 
     InitDescriptors();
 
+    PlanLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -460,6 +468,27 @@ void Graph::InitNodes() {
     }
 }
 
+/**
+ * @brief Runs the per node stage for all the nodes in parallel.
+ * The stage must only modify the node itself, so the nodes don't depend on each other.
+ * The first exception in nodes order is rethrown in the calling thread as in the serial case.
+ */
+template <typename Func>
+static void parallelForNodes(const std::vector<NodePtr>& nodes, const Func& func) {
+    std::vector<std::exception_ptr> errors(nodes.size());
+    parallel_for(nodes.size(), [&](size_t i) {
+        try {
+            func(nodes[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 void Graph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
 
@@ -469,30 +498,48 @@ void Graph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
+    }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
+    // Descriptors enumeration (including creation of oneDNN primitive descriptors) depends only on
+    // the node itself and shapes / precisions of its edges, so it is done for all the nodes in parallel
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "SupportedPrimitiveDescriptors");
+    parallelForNodes(graphNodes, [](const NodePtr& node) {
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    });
 
 #ifdef CPU_DEBUG_CAPS
+    for (auto &node : graphNodes) {
         DEBUG_LOG("==================");
         for (auto & pd : node->getSupportedPrimitiveDescriptors())
             DEBUG_LOG("#", node->getExecIndex(),
                       " ", node->getName(),
                       "  SupportedPrimitiveDescriptor:\n", pd);
-#endif
     }
+#endif
 
+    // Selection depends on the descriptors selected for the parent nodes, so it is done in topological order
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
 }
 
+void Graph::PlanLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::PlanLayouts");
+    reorderBytesSaved = LayoutPlanner(graphNodes).run();
+}
+
 void Graph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -905,18 +952,22 @@ void Graph::Allocate() {
 
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // Primitives creation (JIT code generation, weights reordering into the shared weights cache)
+    // is independent for each node, the runtime cache and scratchpad are thread-safe
+    parallelForNodes(graphNodes, [](const NodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
-        DEBUG_LOG(*node);
         node->createPrimitive();
+    });
 #ifdef CPU_DEBUG_CAPS
+    for (auto& node : graphNodes) {
+        DEBUG_LOG(*node);
         if (node->prim) {
             auto pd_c = (*node->prim).get_primitive_desc();
             auto* pd = reinterpret_cast<const dnnl_primitive_desc*>(pd_c);
             DEBUG_LOG("verbose##", node->getName(), "##", pd->info(), "\n");
         }
-#endif
     }
+#endif
 }
 
 void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -1069,16 +1120,51 @@ void Graph::PullOutputData(BlobMap &out) {
     }
 }
 
+void Graph::InitProfiling() {
+    if (!config.collectPerfCounters)
+        return;
+
+    if (config.collectHwPerfCounters) {
+        hwPerfEvents = HwPerfEvents::create();
+        if (!hwPerfEvents)
+            DEBUG_LOG("Hardware performance counters are not available");
+    }
+
+    if (!config.perfTraceFile.empty()) {
+        if (perfTrace)
+            perfTrace->addEvents(perfTraceSourceId, perfTraceEvents);
+        perfTrace = PerfTrace::get(config.perfTraceFile);
+        perfTraceSourceId = perfTrace->registerSource(_name);
+    }
+}
+
+void Graph::AddPerfTraceEvent(const NodePtr& node) {
+    const auto& counter = node->PerfCounter();
+    perfTraceEvents.push_back({node->getName(),
+                               node->getTypeStr(),
+                               counter.start(),
+                               counter.finish(),
+                               counter.hwLast(),
+                               hwThreadCounters != nullptr});
+    // pass the events to the shared trace in bulk to avoid locking on each node
+    if (perfTraceEvents.size() >= 4096)
+        perfTrace->addEvents(perfTraceSourceId, perfTraceEvents);
+}
+
 void Graph::InferStatic(InferRequestBase* request) {
     dnnl::stream stream(eng);
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+        {
+            PERF_HW(node, config.collectPerfCounters, hwThreadCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
+        if (perfTrace)
+            AddPerfTraceEvent(node);
     }
 }
 
@@ -1161,11 +1247,15 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, config.verbose);
-            PERF(node, config.collectPerfCounters);
+            {
+                PERF_HW(node, config.collectPerfCounters, hwThreadCounters);
 
-            if (request)
-                request->ThrowIfCanceled();
-            ExecuteNode(node, stream);
+                if (request)
+                    request->ThrowIfCanceled();
+                ExecuteNode(node, stream);
+            }
+            if (perfTrace)
+                AddPerfTraceEvent(node);
         }
     }
 }
@@ -1187,6 +1277,21 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    const auto inferStart = PerfTrace::Clock::now();
+    HwPerfEvents::Values hwInferStart = {};
+    if (hwPerfEvents) {
+        if (!hwPerfThreadsRegistered) {
+            // counters are opened per thread, so all the threads which may execute the nodes are registered
+            hwPerfEvents->registerWorkerThreads();
+            hwPerfThreadsRegistered = true;
+        }
+        // the nodes are measured on the thread executing the graph, it may differ between the inferences
+        hwThreadCounters = hwPerfEvents->registerCurrentThread();
+        // the counters of all the threads are read with syscalls, so only once per inference
+        if (perfTrace)
+            hwInferStart = hwPerfEvents->read();
+    }
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
@@ -1195,6 +1300,16 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
 
+    if (perfTrace) {
+        PerfTrace::Event event{"Infer", "Infer", inferStart, PerfTrace::Clock::now(), {}, hwPerfEvents != nullptr};
+        if (hwPerfEvents) {
+            const auto hwInferFinish = hwPerfEvents->read();
+            for (size_t i = 0; i < HwPerfEvents::CountersNum; i++)
+                event.hwValues[i] = hwInferFinish[i] - hwInferStart[i];
+        }
+        perfTraceEvents.push_back(std::move(event));
+    }
+
     if (infer_count != -1) infer_count++;
 }
 
@@ -17,6 +17,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
 
 namespace ov {
 namespace intel_cpu {
@@ -208,6 +209,7 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        reorderBytesSaved.clear();
     }
     Status status { Status::NotReady };
     Config config;
@@ -229,6 +231,9 @@ protected:
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
 
+    // estimated reorder traffic in bytes per inference saved by the layout planning, the key is the node name
+    std::unordered_map<std::string, size_t> reorderBytesSaved;
+
     static dnnl::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const ExtensionManager::Ptr& extMgr);
@@ -236,6 +241,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void PlanLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
@@ -246,6 +252,8 @@ protected:
     void ExecuteConstantNodesOnly() const;
     void InferStatic(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
+    void InitProfiling();
+    void AddPerfTraceEvent(const NodePtr& node);
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -268,6 +276,14 @@ private:
     DnnlScratchPadPtr rtScratchPad;
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // profiling with PERF_COUNT enabled
+    HwPerfEvents::Ptr hwPerfEvents;
+    bool hwPerfThreadsRegistered = false;
+    const HwPerfEvents::ThreadCounters* hwThreadCounters = nullptr;
+    PerfTrace::Ptr perfTrace;
+    int perfTraceSourceId = -1;
+    std::vector<PerfTrace::Event> perfTraceEvents;
+
     void EnforceBF16();
     void setMinSparseRate(float minSparseRate);
 };
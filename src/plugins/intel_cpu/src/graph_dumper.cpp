@@ -104,6 +104,13 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
     } else {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
+    // Average hardware counters per execution, e.g. "cycles", "instructions", "llc_misses"
+    if (node->PerfCounter().hasHwCounters()) {
+        for (size_t i = 0; i < HwPerfEvents::CountersNum; i++) {
+            const auto counter = static_cast<HwPerfEvents::Counter>(i);
+            serialization_info[HwPerfEvents::name(counter)] = std::to_string(node->PerfCounter().hwAvg(counter));
+        }
+    }
 
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
@@ -163,6 +170,11 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
         }
 
         auto meta_data = extract_node_metadata(node);
+        auto saved = graph.reorderBytesSaved.find(node->getName());
+        if (saved != graph.reorderBytesSaved.end()) {
+            // Estimated reorders traffic per inference avoided by the layout planning
+            meta_data["reorderBytesSaved"] = std::to_string(saved->second);
+        }
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
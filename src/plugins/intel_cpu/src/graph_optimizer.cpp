@@ -15,12 +15,16 @@
 #include "nodes/bin_conv.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/mvn.h"
+#include "nodes/softmax.h"
 #include "nodes/transpose.h"
 #include "nodes/interpolate.h"
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/fullyconnected.h"
+#include "nodes/color_convert.h"
 #include "nodes/common/cpu_convert.h"
+#include "ngraph_transformations/convert_matmul_to_fc.hpp"
 
 #include "onednn/dnnl.h"
 
@@ -61,10 +65,18 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndPreprocessing");
+    FuseColorConvertAndPreprocessing(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -89,6 +101,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FusePerformedAsScaleShiftAndFakeQuantize(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FusePerformedAsScaleShiftAndNormalization");
+    FusePerformedAsScaleShiftAndNormalization(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndZeroPoints");
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
@@ -145,6 +161,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSoftmaxAndFakeQuantize");
+    FuseSoftmaxAndFakeQuantize(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseReduceAndSimpleOperation");
     FuseReduceAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -173,6 +193,141 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstInput = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant();
+    };
+    auto isEltwise = [](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm &&
+               node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto fcNode = std::dynamic_pointer_cast<node::FullyConnected>(graphNodes[i]);
+        if (fcNode == nullptr)
+            continue;
+
+        const auto inputPrecision = fcNode->getOriginalInputPrecisionAtPort(0);
+        if (!one_of(inputPrecision, Precision::FP32, Precision::BF16) ||
+            !one_of(fcNode->getInputShapeAtPort(0).getRank(), 2, 3) || fcNode->getInputShapeAtPort(1).getRank() != 2)
+            continue;
+
+        // Convert -> [Subtract] -> Multiply -> [Reshape] -> FullyConnected for u8/i8 weights
+        // or Convert -> FullyConnected for fp16 weights
+        NodePtr reshapeNode = nullptr;
+        auto parentNode = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (parentNode->getType() == Type::Reshape) {
+            if (parentNode->getChildEdges().size() != 1)
+                continue;
+            reshapeNode = parentNode;
+            parentNode = reshapeNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        NodePtr multiplyNode = nullptr;
+        NodePtr multiplyConstNode = nullptr;
+        if (isEltwise(parentNode, Algorithm::EltwiseMultiply)) {
+            multiplyNode = parentNode;
+            multiplyConstNode = multiplyNode->getParentEdgesAtPort(1)[0]->getParent();
+            if (!isConstInput(multiplyConstNode))
+                continue;
+            parentNode = multiplyNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        NodePtr subtractNode = nullptr;
+        NodePtr subtractConstNode = nullptr;
+        NodePtr subtractConvertNode = nullptr;
+        if (multiplyNode && isEltwise(parentNode, Algorithm::EltwiseSubtract)) {
+            subtractNode = parentNode;
+            subtractConstNode = subtractNode->getParentEdgesAtPort(1)[0]->getParent();
+            if (subtractConstNode->getType() == Type::Convert && subtractConstNode->getChildEdges().size() == 1) {
+                subtractConvertNode = subtractConstNode;
+                subtractConstNode = subtractConvertNode->getParentEdgesAtPort(0)[0]->getParent();
+            }
+            if (!isConstInput(subtractConstNode))
+                continue;
+            parentNode = subtractNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        const auto convertNode = parentNode;
+        if (convertNode->getType() != Type::Convert || convertNode->getChildEdges().size() != 1)
+            continue;
+        const auto weightsNode = convertNode->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstInput(weightsNode))
+            continue;
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (multiplyNode ? !one_of(weightsPrecision, Precision::U8, Precision::I8)
+                         : weightsPrecision != Precision::FP16 || reshapeNode)
+            continue;
+
+        // The kernel with weights decompression has no post ops, so it pays off only for a few source rows.
+        // ConvertMatMulToFC folds the decompression of FullyConnected with more rows, it's checked here
+        // in case the shapes are refined after that.
+        const auto& srcMaxDims = fcNode->getInputShapeAtPort(0).getMaxDims();
+        size_t maxRows = 1;
+        for (size_t j = 0; j + 1 < srcMaxDims.size() && maxRows <= maxRowsWithWeightsDecompression; j++)
+            maxRows = srcMaxDims[j] == Shape::UNDEFINED_DIM ? Shape::UNDEFINED_DIM : maxRows * srcMaxDims[j];
+        if (maxRows > maxRowsWithWeightsDecompression)
+            continue;
+
+        // Weights are [OC, IC], or [OC, G, IC / G] with Reshape to [OC, IC] in case of group decompression.
+        // Decompression constants must be broadcastable to [OC, G, 1] or [OC, 1] respectively.
+        const auto& weightsDims = convertNode->getOutputShapeAtPort(0).getStaticDims();
+        if (weightsDims.size() != (reshapeNode ? 3 : 2) || weightsDims[0] != fcNode->getInputShapeAtPort(1).getStaticDims()[0])
+            continue;
+        const size_t groups = reshapeNode ? weightsDims[1] : 1;
+        auto isSuitableConst = [&](const NodePtr& constNode) {
+            const auto& shape = constNode->getOutputShapeAtPort(0);
+            if (shape.getElementsCount() == 1)
+                return true;
+            const auto& dims = shape.getStaticDims();
+            return dims.size() == weightsDims.size() && dims[0] == weightsDims[0] && dims.back() == 1 &&
+                   (dims.size() == 2 || one_of(dims[1], 1, groups));
+        };
+        if ((multiplyConstNode && !isSuitableConst(multiplyConstNode)) || (subtractConstNode && !isSuitableConst(subtractConstNode)))
+            continue;
+
+        fcNode->fuseDecompressionConvert();
+        fcNode->addOriginalLayer(convertNode->getOriginalLayers());
+        if (multiplyNode) {
+            fcNode->fuseDecompressionMultiply(multiplyConstNode);
+            fcNode->addOriginalLayer(multiplyNode->getOriginalLayers());
+        }
+        if (subtractNode) {
+            fcNode->fuseDecompressionSubtract(subtractConstNode);
+            fcNode->addOriginalLayer(subtractNode->getOriginalLayers());
+        }
+
+        auto removeConstEdge = [&](const NodePtr& node) {
+            auto edge = node->getParentEdgesAtPort(1)[0];
+            edge->drop();
+            graph.RemoveEdge(edge);
+        };
+        if (multiplyNode) {
+            removeConstEdge(multiplyNode);
+            graph.DropNode(multiplyNode);
+        }
+        if (subtractNode) {
+            if (subtractConvertNode) {
+                auto edge = subtractConvertNode->getParentEdgesAtPort(0)[0];
+                edge->drop();
+                graph.RemoveEdge(edge);
+            }
+            removeConstEdge(subtractNode);
+            graph.DropNode(subtractNode);
+        }
+        graph.DropNode(convertNode);
+
+        // FullyConnected consumes compressed weights as is
+        if (reshapeNode) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -352,6 +507,35 @@ void GraphOptimizer::FuseDeconvolutionAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseColorConvertAndPreprocessing(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (auto &graphNode : graphNodes) {
+        auto colorConvert = std::dynamic_pointer_cast<ColorConvert>(graphNode);
+        if (!colorConvert)
+            continue;
+
+        // absorb the chain of preprocessing operations following the color conversion
+        while (colorConvert->getChildEdges().size() == 1) {
+            auto childNode = colorConvert->getChildEdgeAt(0)->getChild();
+            if (!colorConvert->fusePreprocessing(childNode))
+                break;
+            colorConvert->addOriginalLayer(childNode->getOriginalLayers());
+
+            std::vector<EdgePtr> constEdges;
+            for (size_t i = 0; i < childNode->getParentEdges().size(); i++) {
+                auto parentEdge = childNode->getParentEdgeAt(i);
+                if (parentEdge->getParent() != colorConvert)
+                    constEdges.push_back(parentEdge);
+            }
+            for (auto &constEdge : constEdges) {
+                graph.RemoveEdge(constEdge);
+            }
+            graph.DropNode(childNode);
+        }
+    }
+}
+
 void GraphOptimizer::FuseMultiplyAndAdd(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1517,6 +1701,42 @@ void GraphOptimizer::FuseNormalizeL2AndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseSoftmaxAndFakeQuantize(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](NodePtr node) {
+        return node->getType() == Type::Softmax && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        auto parentEdges = childNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getParent()->getType() == Type::Softmax)
+                continue;
+
+            graph.RemoveEdge(p_edge);
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseReduceAndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1974,6 +2194,151 @@ void GraphOptimizer::FusePerformedAsScaleShiftAndFakeQuantize(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FusePerformedAsScaleShiftAndNormalization(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto getNonConstPort = [](const NodePtr& node) {
+        int nonConstPort = -1;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto& parent = node->getParentEdgeAt(i)->getParent();
+            if (parent->getType() == Type::Input && parent->isConstant())
+                continue;
+            if (nonConstPort != -1)
+                return -1;
+            nonConstPort = static_cast<int>(i);
+        }
+        return nonConstPort;
+    };
+
+    auto isSuitableScaleShiftNode = [getNonConstPort](const NodePtr& node) {
+        if (!one_of(node->getAlgorithm(), Algorithm::EltwiseAdd,
+                                          Algorithm::EltwiseSubtract,
+                                          Algorithm::EltwiseMultiply,
+                                          Algorithm::EltwiseDivide,
+                                          Algorithm::EltwiseMulAdd,
+                                          Algorithm::EltwisePowerStatic))
+            return false;
+
+        const auto nonConstPort = getNonConstPort(node);
+        if (nonConstPort == -1 || !node->getFusedWith().empty() ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+            !one_of(node->getOriginalInputPrecisionAtPort(nonConstPort), Precision::FP32, Precision::U8, Precision::I8))
+            return false;
+
+        const NodePtr eltwiseInput = node->getParentEdgeAt(nonConstPort)->getParent();
+        return node->getChildEdges().size() == 1 && node->canBePerformedAsScaleShift(eltwiseInput.get());
+    };
+
+    // int8 -> fp32 conversion is exact, and MVN and SoftMax read int8 data directly
+    auto isSuitableConvertNode = [](const NodePtr& node) {
+        return node->getType() == Type::Convert && node->getChildEdges().size() == 1 &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8) &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isSuitableNormalizationNode = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::MVN, Type::Softmax) &&
+               node->getOriginalInputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto dropParent = [&graph](const NodePtr& node, const NodePtr& parent, int dataPort) {
+        auto parentEdges = parent->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getOutputNum() == dataPort)
+                continue;
+
+            graph.RemoveEdge(p_edge);
+        }
+
+        node->setOriginalInputPrecisionAtPort(0, parent->getOriginalInputPrecisionAtPort(dataPort));
+        node->addOriginalLayer(parent->getOriginalLayers());
+        graph.DropNode(parent);
+    };
+
+    // The dequantization of int8 data (Convert, Subtract, Multiply, etc.) in front of MVN is removed altogether:
+    // MVN takes the int8 data, while the scale is taken into account by epsilon.
+    auto fuseIntoMVN = [&](const NodePtr& node) {
+        auto mvnNode = std::dynamic_pointer_cast<MVN>(node);
+        if (mvnNode == nullptr)
+            IE_THROW() << "Cannot cast " << node->getName() << " to MVN node";
+
+        Precision inputPrecision = Precision::FP32;
+        while (inputPrecision == Precision::FP32) {
+            auto parent = mvnNode->getParentEdgeAt(0)->getParent();
+            int dataPort = 0;
+            if (isSuitableScaleShiftNode(parent)) {
+                dataPort = getNonConstPort(parent);
+                std::vector<float> scales;
+                std::vector<float> shifts;
+                std::tie(scales, shifts) =
+                    parent->getScalesAndShifts(parent->getParentEdgeAt(dataPort)->getParent().get());
+                if (!mvnNode->fuseInputScaleShift(scales, shifts))
+                    break;
+            } else if (!isSuitableConvertNode(parent)) {
+                break;
+            }
+            inputPrecision = parent->getOriginalInputPrecisionAtPort(dataPort);
+            dropParent(mvnNode, parent, dataPort);
+        }
+    };
+
+    // SoftMax takes the int8 data and applies the scale on the fly, while the shift doesn't change the result.
+    // Unlike MVN, it's done only if the whole dequantization is removed: the fp32 input is handled by oneDNN better.
+    auto fuseIntoSoftMax = [&](const NodePtr& node) {
+        auto softmaxNode = std::dynamic_pointer_cast<SoftMax>(node);
+        if (softmaxNode == nullptr)
+            IE_THROW() << "Cannot cast " << node->getName() << " to SoftMax node";
+
+        std::vector<std::pair<NodePtr, int>> chain;
+        Precision inputPrecision = Precision::FP32;
+        auto parent = softmaxNode->getParentEdgeAt(0)->getParent();
+        while (inputPrecision == Precision::FP32) {
+            int dataPort = 0;
+            if (isSuitableScaleShiftNode(parent)) {
+                dataPort = getNonConstPort(parent);
+                std::vector<float> scales;
+                std::vector<float> shifts;
+                std::tie(scales, shifts) =
+                    parent->getScalesAndShifts(parent->getParentEdgeAt(dataPort)->getParent().get());
+                if (!softmaxNode->canFuseInputScaleShift(scales, shifts))
+                    return;
+            } else if (!isSuitableConvertNode(parent)) {
+                return;
+            }
+            chain.emplace_back(parent, dataPort);
+            inputPrecision = parent->getOriginalInputPrecisionAtPort(dataPort);
+            parent = parent->getParentEdgeAt(dataPort)->getParent();
+        }
+        if (!one_of(inputPrecision, Precision::U8, Precision::I8))
+            return;
+
+        for (const auto& link : chain) {
+            parent = link.first;
+            if (parent->getType() == Type::Eltwise) {
+                std::vector<float> scales;
+                std::vector<float> shifts;
+                std::tie(scales, shifts) =
+                    parent->getScalesAndShifts(parent->getParentEdgeAt(link.second)->getParent().get());
+                softmaxNode->fuseInputScaleShift(scales, shifts);
+            }
+            dropParent(softmaxNode, parent, link.second);
+        }
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto node = graphNodes[i];
+        if (!isSuitableNormalizationNode(node))
+            continue;
+
+        if (node->getType() == Type::MVN) {
+            fuseIntoMVN(node);
+        } else {
+            fuseIntoSoftMax(node);
+        }
+    }
+}
+
 void GraphOptimizer::MergeTransposeAndReorder(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
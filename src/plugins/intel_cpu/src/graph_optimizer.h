@@ -20,8 +20,10 @@ public:
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
 
 private:
+    void FuseFCAndWeightsDecompression(Graph &graph);
     void FuseConvolutionMatMulDeconvAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
+    void FuseColorConvertAndPreprocessing(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
     void MergeConvertAndScaleShift(Graph& graph);
     void FuseFullyConnectedAndSimpleOperation(Graph &graph);
@@ -34,6 +36,7 @@ private:
     void FuseMVNAndSimpleOperation(Graph &graph);
     void FuseInterpolateAndSimpleOperation(Graph &graph);
     void FuseNormalizeL2AndSimpleOperation(Graph &graph);
+    void FuseSoftmaxAndFakeQuantize(Graph &graph);
     void FuseReduceAndSimpleOperation(Graph &graph);
 
     void DropDoubleReorders(Graph& graph);
@@ -41,6 +44,7 @@ private:
     void FuseBroadcastAndEltwise(Graph &graph);
     void FuseEltwiseAndSimple(Graph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(Graph &graph);
+    void FusePerformedAsScaleShiftAndNormalization(Graph &graph);
     void FuseClampAndFakeQuantize(Graph &graph);
     void MergeTransposeAndReorder(Graph &graph);
     void reshapeRnnSeq(Graph &graph);
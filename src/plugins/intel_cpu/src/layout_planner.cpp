@@ -0,0 +1,300 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layout_planner.h"
+
+#include "edge.h"
+#include "utils/debug_capabilities.h"
+
+#include <algorithm>
+#include <deque>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr size_t maxDescentIterations = 4;
+
+// optimization approach of the implementation type, the kernel efficiency is assumed to be comparable within it
+constexpr int implKindMask = impl_desc_type::simple | impl_desc_type::ref | impl_desc_type::jit |
+                             impl_desc_type::gemm | impl_desc_type::brgconv | impl_desc_type::brgemm;
+
+bool hasLayout(const NodeDesc& pd, LayoutType layout) {
+    const auto& config = pd.getConfig();
+    // the other inputs are weights, scalars, broadcasted tensors, etc.
+    if (!config.inConfs.empty() && !config.inConfs[0].getMemDesc()->hasLayoutType(layout))
+        return false;
+    for (const auto& outConf : config.outConfs) {
+        if (!outConf.getMemDesc()->hasLayoutType(layout))
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int LayoutPlanner::getSelectedIndex(const NodePtr& node) {
+    return node->selectedPrimitiveDescriptorIndex;
+}
+
+void LayoutPlanner::setSelectedIndex(const NodePtr& node, int index) {
+    // the in-place status is reset once the planning is done, the cost doesn't depend on it
+    node->selectedPrimitiveDescriptorIndex = index;
+}
+
+bool LayoutPlanner::isFlexible(const NodePtr& node) const {
+    if (node->isConstant() || node->getSupportedPrimitiveDescriptors().size() < 2 ||
+        node->getSelectedPrimitiveDescriptor() == nullptr)
+        return false;
+
+    switch (node->getType()) {
+    // graph boundaries
+    case Type::Input:
+    case Type::Output:
+    case Type::MemoryInput:
+    case Type::MemoryOutput:
+    // kernels efficiency depends on the layout much more than the reorder traffic
+    case Type::Convolution:
+    case Type::BinaryConvolution:
+    case Type::DeformableConvolution:
+    case Type::Deconvolution:
+    case Type::FullyConnected:
+    case Type::MatMul:
+    case Type::Pooling:
+    case Type::AdaptivePooling:
+    case Type::RNNCell:
+    case Type::RNNSeq:
+    case Type::MHA:
+    case Type::Subgraph:
+    // the selection is done with respect to the in-place memory usage
+    case Type::Concatenation:
+    case Type::Split:
+    case Type::Reorder:
+    // inner graphs are already built for the selected descriptors
+    case Type::If:
+    case Type::TensorIterator:
+        return false;
+    default:
+        return true;
+    }
+}
+
+size_t LayoutPlanner::edgeCost(const EdgePtr& edge) {
+    const auto parent = edge->getParent();
+    const auto child = edge->getChild();
+    // reorders of constant data are executed once on the network loading
+    if (parent->isConstant())
+        return 0;
+
+    const auto* parentPd = parent->getSelectedPrimitiveDescriptor();
+    const auto* childPd = child->getSelectedPrimitiveDescriptor();
+    if (parentPd == nullptr || childPd == nullptr)
+        return 0;
+
+    const auto& outConfs = parentPd->getConfig().outConfs;
+    const auto& inConfs = childPd->getConfig().inConfs;
+    const int inNum = edge->getInputNum();
+    const int outNum = edge->getOutputNum();
+    if (inNum < 0 || inNum >= outConfs.size() || outNum < 0 || outNum >= inConfs.size())
+        return 0;
+
+    const auto& srcDesc = outConfs[inNum].getMemDesc();
+    const auto& dstDesc = inConfs[outNum].getMemDesc();
+    if (dstDesc->isCompatible(*srcDesc))
+        return 0;
+
+    // upper bounds of the dynamic dimensions if any, the lower bounds otherwise
+    const auto& shape = srcDesc->getShape();
+    size_t elements = 1;
+    for (size_t i = 0; i < shape.getRank(); i++) {
+        const auto maxDim = shape.getMaxDims()[i];
+        elements *= maxDim != Shape::UNDEFINED_DIM ? maxDim : std::max<Dim>(shape.getMinDims()[i], 1);
+    }
+    return elements * (srcDesc->getPrecision().size() + dstDesc->getPrecision().size());
+}
+
+size_t LayoutPlanner::nodeCost(const NodePtr& node) {
+    size_t cost = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        cost += edgeCost(node->getParentEdgeAt(i));
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        cost += edgeCost(node->getChildEdgeAt(i));
+    return cost;
+}
+
+size_t LayoutPlanner::regionCost(const Region& region, const std::unordered_set<const Node*>& members) {
+    size_t cost = 0;
+    for (const auto& node : region) {
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            cost += edgeCost(node->getParentEdgeAt(i));
+        // the edges inside the region are counted as the parent ones
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (!members.count(edge->getChild().get()))
+                cost += edgeCost(edge);
+        }
+    }
+    return cost;
+}
+
+bool LayoutPlanner::isCandidate(const NodePtr& node, int index, int selected) {
+    const auto& pds = node->getSupportedPrimitiveDescriptors();
+    const auto& pd = pds[index];
+    const auto& selectedPd = pds[selected];
+    return (pd.getImplementationType() & implKindMask) == (selectedPd.getImplementationType() & implKindMask) &&
+           pd.getConfig().inConfs.size() <= node->getParentEdges().size() &&
+           pd.getConfig().outConfs.size() == selectedPd.getConfig().outConfs.size();
+}
+
+std::vector<LayoutPlanner::Region> LayoutPlanner::findRegions() const {
+    std::vector<Region> regions;
+    std::unordered_set<const Node*> visited;
+    for (const auto& node : graphNodes) {
+        if (visited.count(node.get()) || !isFlexible(node))
+            continue;
+
+        Region region;
+        std::deque<NodePtr> queue{node};
+        visited.insert(node.get());
+        while (!queue.empty()) {
+            auto current = queue.front();
+            queue.pop_front();
+            region.push_back(current);
+
+            auto visit = [&](const NodePtr& neighbour) {
+                if (!visited.count(neighbour.get()) && isFlexible(neighbour)) {
+                    visited.insert(neighbour.get());
+                    queue.push_back(neighbour);
+                }
+            };
+            for (size_t i = 0; i < current->getParentEdges().size(); i++)
+                visit(current->getParentEdgeAt(i)->getParent());
+            for (size_t i = 0; i < current->getChildEdges().size(); i++)
+                visit(current->getChildEdgeAt(i)->getChild());
+        }
+        regions.push_back(std::move(region));
+    }
+    return regions;
+}
+
+bool LayoutPlanner::planRegion(const Region& region) {
+    std::unordered_set<const Node*> members;
+    std::vector<int> initial;
+    for (const auto& node : region) {
+        members.insert(node.get());
+        initial.push_back(getSelectedIndex(node));
+    }
+
+    const size_t initialCost = regionCost(region, members);
+    size_t bestCost = initialCost;
+    std::vector<int> best = initial;
+    for (const auto layout : {LayoutType::ncsp, LayoutType::nspc, LayoutType::nCsp8c, LayoutType::nCsp16c}) {
+        std::vector<int> assignment = initial;
+        for (size_t i = 0; i < region.size(); i++) {
+            const auto& pds = region[i]->getSupportedPrimitiveDescriptors();
+            if (hasLayout(pds[initial[i]], layout))
+                continue;
+            // the nodes which don't support the layout keep their choice
+            for (int j = 0; j < pds.size(); j++) {
+                if (isCandidate(region[i], j, initial[i]) && hasLayout(pds[j], layout)) {
+                    assignment[i] = j;
+                    break;
+                }
+            }
+        }
+        if (assignment == initial)
+            continue;
+
+        for (size_t i = 0; i < region.size(); i++)
+            setSelectedIndex(region[i], assignment[i]);
+        const size_t cost = regionCost(region, members);
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = assignment;
+        }
+    }
+
+    for (size_t i = 0; i < region.size(); i++)
+        setSelectedIndex(region[i], best[i]);
+    if (bestCost == initialCost)
+        return false;
+
+    // the gain of the region is attributed to its first revised node
+    for (size_t i = 0; i < region.size(); i++) {
+        if (best[i] != initial[i]) {
+            savedBytes[region[i]->getName()] += initialCost - bestCost;
+            DEBUG_LOG("Layout of region starting from ", region[i]->getName(), " is revised, ",
+                      initialCost - bestCost, " bytes of reorders are saved");
+            break;
+        }
+    }
+    return true;
+}
+
+bool LayoutPlanner::planNode(const NodePtr& node) {
+    const int initial = getSelectedIndex(node);
+    const size_t initialCost = nodeCost(node);
+    size_t bestCost = initialCost;
+    int best = initial;
+    for (int i = 0; i < node->getSupportedPrimitiveDescriptors().size() && bestCost > 0; i++) {
+        if (i == initial || !isCandidate(node, i, initial))
+            continue;
+        setSelectedIndex(node, i);
+        const size_t cost = nodeCost(node);
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = i;
+        }
+    }
+
+    setSelectedIndex(node, best);
+    if (best == initial)
+        return false;
+
+    savedBytes[node->getName()] += initialCost - bestCost;
+    DEBUG_LOG("Layout of ", node->getName(), " is revised, ", initialCost - bestCost, " bytes of reorders are saved");
+    return true;
+}
+
+std::unordered_map<std::string, size_t> LayoutPlanner::run() {
+    std::vector<NodePtr> flexibleNodes;
+    std::vector<int> initial;
+    for (const auto& node : graphNodes) {
+        if (isFlexible(node)) {
+            flexibleNodes.push_back(node);
+            initial.push_back(getSelectedIndex(node));
+        }
+    }
+    if (flexibleNodes.empty())
+        return {};
+
+    for (const auto& region : findRegions()) {
+        if (region.size() > 1)
+            planRegion(region);
+    }
+
+    // the forward pass follows the producers, the backward one follows the consumers
+    bool improved = true;
+    for (size_t iteration = 0; iteration < maxDescentIterations && improved; iteration++) {
+        improved = false;
+        if (iteration % 2 == 0) {
+            for (auto it = flexibleNodes.begin(); it != flexibleNodes.end(); ++it)
+                improved = planNode(*it) || improved;
+        } else {
+            for (auto it = flexibleNodes.rbegin(); it != flexibleNodes.rend(); ++it)
+                improved = planNode(*it) || improved;
+        }
+    }
+
+    for (size_t i = 0; i < flexibleNodes.size(); i++) {
+        const int selected = getSelectedIndex(flexibleNodes[i]);
+        if (selected != initial[i])
+            flexibleNodes[i]->selectPrimitiveDescriptorByIndex(selected);
+    }
+    return savedBytes;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
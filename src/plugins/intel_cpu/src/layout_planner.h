@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Global layout assignment which revises the primitive descriptors greedily selected by the nodes.
+ * Node::selectOptimalPrimitiveDescriptor only takes the parents into account, so a layout is kept until some
+ * consumer does not support it, and a Reorder is inserted on every such edge later in Graph::InitEdges.
+ *
+ * The cost of an assignment is the estimated traffic of the Reorders it requires: the number of elements of an edge
+ * multiplied by the size of read and written elements. Kernel efficiency is preserved by the planning constraints:
+ * compute-bound nodes (convolutions, matmuls, poolings, etc.), graph inputs/outputs, and in-place Concat/Split keep
+ * their choice, and the other nodes may only switch to a descriptor with the same optimization approach (jit, ref, etc.).
+ *
+ * Two kinds of moves are applied while they decrease the cost:
+ * 1. Every connected region of the layout flexible nodes is tried in each of the common layouts as a whole,
+ *    e.g. to move a Reorder in front of a branching point.
+ * 2. Node by node descent in forward and backward order, which takes the consumers into account.
+ */
+class LayoutPlanner {
+public:
+    explicit LayoutPlanner(const std::vector<NodePtr>& graphNodes) : graphNodes(graphNodes) {}
+
+    /**
+     * @brief Reassigns the selected primitive descriptors, must be called after the selection of descriptors
+     * @return estimated reorder traffic in bytes per inference saved by revising the descriptors of the nodes,
+     * the key is the node name
+     */
+    std::unordered_map<std::string, size_t> run();
+
+private:
+    using Region = std::vector<NodePtr>;
+
+    bool isFlexible(const NodePtr& node) const;
+    std::vector<Region> findRegions() const;
+
+    bool planRegion(const Region& region);
+    bool planNode(const NodePtr& node);
+
+    static int getSelectedIndex(const NodePtr& node);
+    static void setSelectedIndex(const NodePtr& node, int index);
+    static bool isCandidate(const NodePtr& node, int index, int selected);
+    static size_t edgeCost(const EdgePtr& edge);
+    static size_t nodeCost(const NodePtr& node);
+    static size_t regionCost(const Region& region, const std::unordered_set<const Node*>& members);
+
+    const std::vector<NodePtr>& graphNodes;
+    std::unordered_map<std::string, size_t> savedBytes;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -7,14 +7,83 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <transformations/rt_info/decompression.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 
 #include "itt.hpp"
 
+namespace {
+
+bool isConvertedConstant(const ov::Node* node) {
+    return ov::is_type<ov::opset1::Convert>(node) && ov::is_type<ov::opset1::Constant>(node->get_input_node_ptr(0)) &&
+           node->get_input_element_type(0).is_integral_number() && node->get_output_element_type(0).is_real();
+}
+
+bool isConstantOrConvertedConstant(const ov::Node* node) {
+    return ov::is_type<ov::opset1::Constant>(node) || isConvertedConstant(node);
+}
+
+bool fits_weights_decompression(const ov::PartialShape& shape_a, bool transpose_a) {
+    // the number of rows is the product of all the dimensions except the inner product one
+    const size_t rank = shape_a.size();
+    const size_t k_axis = transpose_a ? rank - 2 : rank - 1;
+    int64_t rows = 1;
+    for (size_t i = 0; i < rank; i++) {
+        if (i == k_axis) {
+            continue;
+        }
+        const auto max_dim = shape_a[i].get_max_length();
+        if (max_dim < 0 || (max_dim > 0 && rows > static_cast<int64_t>(ov::intel_cpu::maxRowsWithWeightsDecompression) / max_dim)) {
+            return false;
+        }
+        rows *= max_dim;
+    }
+    return rows <= static_cast<int64_t>(ov::intel_cpu::maxRowsWithWeightsDecompression);
+}
+
+// Folds the decompression subgraph (optionally followed by Reshape) ignoring disabled constant folding
+std::shared_ptr<ov::opset1::Constant> fold_decompression(const std::shared_ptr<ov::Node>& node) {
+    if (const auto constant = std::dynamic_pointer_cast<ov::opset1::Constant>(node)) {
+        return constant;
+    }
+    ov::OutputVector inputs;
+    for (const auto& input : node->input_values()) {
+        const auto folded_input = fold_decompression(input.get_node_shared_ptr());
+        if (!folded_input) {
+            return nullptr;
+        }
+        inputs.push_back(folded_input);
+    }
+    return std::dynamic_pointer_cast<ov::opset1::Constant>(ov::op::util::clone_try_fold(node, inputs));
+}
+
+}  // namespace
+
+bool ov::intel_cpu::isWeightsDecompressionNode(const std::shared_ptr<const ov::Node>& node) {
+    if (ov::is_type<ov::opset1::Convert>(node)) {
+        // fp16 weights kept compressed by the plugin
+        return node->get_input_element_type(0) == ov::element::f16 && node->get_output_element_type(0) == ov::element::f32 &&
+               ov::is_type<ov::opset1::Constant>(node->get_input_node_ptr(0)) &&
+               ov::is_decompression(std::const_pointer_cast<ov::Node>(node));
+    }
+    if (ov::is_type<ov::opset1::Subtract>(node)) {
+        return isConvertedConstant(node->get_input_node_ptr(0)) && isConstantOrConvertedConstant(node->get_input_node_ptr(1));
+    }
+    if (ov::is_type<ov::opset1::Multiply>(node)) {
+        const auto data = node->get_input_node_shared_ptr(0);
+        return (isConvertedConstant(data.get()) || (ov::is_type<ov::opset1::Subtract>(data) && isWeightsDecompressionNode(data))) &&
+               ov::is_type<ov::opset1::Constant>(node->get_input_node_ptr(1));
+    }
+    return false;
+}
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -45,7 +114,31 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        // Compressed weights come through a decompression subgraph (optionally followed by Reshape for grouped
+        // quantization) which is fused into FullyConnected by the graph optimizer, only 2D weights are supported here.
+        const auto weights_node = fc_input_b.get_node_shared_ptr();
+        const auto decompression_node = ngraph::is_type<ngraph::opset1::Reshape>(weights_node) ?
+                                        weights_node->get_input_node_shared_ptr(0) : weights_node;
+        bool with_decompression = isWeightsDecompressionNode(decompression_node);
+        if (with_decompression && !fits_weights_decompression(shape_a, matmul->get_transpose_a())) {
+            // the weights are kept only decompressed like the ones without decompression support,
+            // the folded constant is shared by all the consumers of the decompression subgraph
+            const auto folded = fold_decompression(weights_node);
+            if (!folded) {
+                return false;
+            }
+            folded->set_friendly_name(weights_node->get_friendly_name());
+            ngraph::copy_runtime_info(weights_node, folded);
+            ngraph::replace_node(weights_node, folded);
+            fc_input_b = folded;
+            with_decompression = false;
+        }
+        if (with_decompression) {
+            // transposition is applied to the compressed data, so the weights of grouped decompression can't be transposed
+            if (rank_b != 2 || (!matmul->get_transpose_b() && decompression_node != weights_node)) {
+                return false;
+            }
+        } else if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -134,10 +227,75 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // Transferring from MatMul representation: [B, I, K] * [B, K, O] = [B, I, O]
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
+        /*
+         *  transpose_decompression function transposes decompression subgraph by transposing its compressed data,
+         *  zero points and scales, since the decompressed weights are not folded. 1D constants are broadcasted
+         *  along the last dimension of the weights, so they are reshaped to [1, N] before transposition.
+         */
+        auto transpose_decompression = [&](const std::shared_ptr<ngraph::Node>& decompression) {
+            auto transpose_constant = [&](const ngraph::Output<ngraph::Node>& node) -> ngraph::Output<ngraph::Node> {
+                const auto& shape = node.get_shape();
+                if (ngraph::shape_size(shape) == 1) {
+                    return node;
+                }
+                ngraph::Output<ngraph::Node> input = node;
+                if (shape.size() == 1) {
+                    auto shape_2d = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 },
+                                                                     std::vector<int64_t>{ 1, static_cast<int64_t>(shape[0]) });
+                    input = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(input, shape_2d, false);
+                }
+                return create_transpose(input, node.get_node()->get_friendly_name() + "/transpose_b");
+            };
+            auto transpose_data = [&](const ngraph::Output<ngraph::Node>& node) -> ngraph::Output<ngraph::Node> {
+                const auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(node.get_node_shared_ptr());
+                if (!convert) {
+                    return transpose_constant(node);
+                }
+                auto new_convert = std::make_shared<ngraph::opset1::Convert>(transpose_constant(convert->input_value(0)),
+                                                                             convert->get_destination_type());
+                new_convert->set_friendly_name(convert->get_friendly_name());
+                ngraph::copy_runtime_info(convert, new_convert);
+                ov::disable_constant_folding(new_convert);
+                if (ov::is_decompression(convert)) {
+                    ov::mark_as_decompression(new_convert);
+                }
+                return new_convert;
+            };
+
+            // fp16 weights are decompressed by the Convert only
+            if (ngraph::is_type<ngraph::opset1::Convert>(decompression)) {
+                return transpose_data(decompression);
+            }
+
+            const auto& multiply = decompression;
+            ngraph::Output<ngraph::Node> data;
+            const auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(multiply->get_input_node_shared_ptr(0));
+            if (subtract) {
+                auto new_subtract = std::make_shared<ngraph::opset1::Subtract>(transpose_data(subtract->input_value(0)),
+                                                                               transpose_data(subtract->input_value(1)));
+                new_subtract->set_friendly_name(subtract->get_friendly_name());
+                ngraph::copy_runtime_info(subtract, new_subtract);
+                ov::mark_as_dequantization_node(new_subtract);
+                data = new_subtract;
+            } else {
+                data = transpose_data(multiply->input_value(0));
+            }
+
+            auto new_multiply = std::make_shared<ngraph::opset1::Multiply>(data, transpose_constant(multiply->input_value(1)));
+            new_multiply->set_friendly_name(multiply->get_friendly_name());
+            ngraph::copy_runtime_info(multiply, new_multiply);
+            ov::mark_as_dequantization_node(new_multiply);
+            return ngraph::Output<ngraph::Node>(new_multiply);
+        };
+
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
-            new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            if (with_decompression) {
+                fc_input_b = transpose_decompression(decompression_node);
+            } else {
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
         }
 
         if (rank_b != 2) {
@@ -15,5 +15,28 @@ public:
     ConvertMatMulToFC();
 };
 
+/**
+ * @brief Checks that the node is a part of weights decompression subgraph on compressed constant data:
+ *
+ *     Constant (u8/i8)
+ *         |
+ *      Convert   zero point (optional)
+ *          \     /
+ *          Subtract   scale
+ *              \      /
+ *              Multiply
+ *
+ * or fp16 Constant with decompression Convert to f32.
+ * Such subgraphs are kept unfolded and fused into FullyConnected node, so the weights stay compressed.
+ */
+bool isWeightsDecompressionNode(const std::shared_ptr<const ov::Node>& node);
+
+/**
+ * @brief Max number of the source rows of FullyConnected with fused weights decompression. The decompression
+ * is executed by the node's own kernel without post ops, which pays off only for a few rows, so the decompression
+ * subgraphs of FullyConnected with more rows (or unbounded number of rows) are constant folded by ConvertMatMulToFC.
+ */
+constexpr size_t maxRowsWithWeightsDecompression = 16;
+
 }   // namespace intel_cpu
 }   // namespace ov
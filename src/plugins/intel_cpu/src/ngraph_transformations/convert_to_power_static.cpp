@@ -12,6 +12,7 @@
 #include <ngraph/pattern/op/or.hpp>
 #include "op/power_static.hpp"
 #include "op/fully_connected.hpp"
+#include "convert_matmul_to_fc.hpp"
 #include "utils/general_utils.h"
 
 #include "itt.hpp"
@@ -45,6 +46,7 @@ bool isConvertableToPowerStatic(const std::shared_ptr<BaseOp> &node) {
     auto const_shape = node->get_input_shape(constPort);
     return ngraph::shape_size(const_shape) == 1 &&
            input_rank.get_length() >= const_shape.size() &&
+           !ov::intel_cpu::isWeightsDecompressionNode(node) &&
            !ov::intel_cpu::one_of(node->get_input_node_shared_ptr(nonConstPort)->get_type_info(),
                                  ngraph::opset1::NormalizeL2::get_type_info_static(),
                                  ngraph::opset4::Interpolate::get_type_info_static(),
@@ -654,6 +654,7 @@ protected:
     friend class Edge;
     friend class Graph;
     friend class GraphOptimizer;
+    friend class LayoutPlanner;
 
     void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs);
     bool isConfigDefined(const NodeConfig &config) const;
@@ -3,6 +3,8 @@
 //
 
 #include "color_convert.h"
+#include "input.h"
+#include "transpose.h"
 #include <memory_desc/dnnl_blocked_memory_desc.h>
 #include <openvino/op/nv12_to_rgb.hpp>
 #include <openvino/op/nv12_to_bgr.hpp>
@@ -266,18 +268,21 @@ void jit_uni_converter::store_tail(const variable<T*> & dst,
 
 namespace nv12 {
 
-ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
+ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(ColorConvert *node) {
     const LayoutType layout = LayoutType::ncsp; // 0,1,2,3
 
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    const Precision outPrecision = node->getFusedPreprocessing().u8ToFP32
+                                    ? Precision::FP32
+                                    : precision;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
-                        mayiuse(cpu_isa_t::sse41)
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
+                        mayiuse(cpu_isa_t::sse41) && !node->hasFusedPreprocessing()
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
                         true);
@@ -615,18 +620,21 @@ public:
 
 namespace i420 {
 
-ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
+ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(ColorConvert *node) {
     const LayoutType layout = LayoutType::ncsp; // 0,1,2,3
 
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    const Precision outPrecision = node->getFusedPreprocessing().u8ToFP32
+                                    ? Precision::FP32
+                                    : precision;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
-                        mayiuse(cpu_isa_t::sse41)
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
+                        mayiuse(cpu_isa_t::sse41) && !node->hasFusedPreprocessing()
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
                         true);
@@ -966,6 +974,76 @@ public:
 
 }   // namespace i420
 
+namespace fused {
+
+/**
+ * Color conversion with the fused preprocessing done in a single pass: every converted pixel is scaled, shifted
+ * and stored to the interleaved or planar output of the requested precision.
+ */
+template<typename TIn, typename TOut>
+class SinglePassConvert : public Converter {
+public:
+    SinglePassConvert(Node *node)
+        : Converter(node)
+        , _i420(one_of(node->getAlgorithm(), Algorithm::ColorConvertI420toRGB, Algorithm::ColorConvertI420toBGR)) {}
+
+    void execute(dnnl::stream strm) override {
+        const auto & fused = static_cast<ColorConvert*>(_node)->getFusedPreprocessing();
+        const auto & dims = inputDims(0);
+
+        const size_t batch_size = dims[N_DIM];
+        const size_t height = singlePlane() ? dims[H_DIM] * 2 / 3 : dims[H_DIM];
+        const size_t width = dims[W_DIM];
+        const size_t plane_size = height * width;
+
+        // NV12 has interleaved UV plane, I420 has separate U and V planes of half width
+        const TIn* y = static_cast<const TIn*>(input(0));
+        const TIn* u = singlePlane() ? y + plane_size : static_cast<const TIn*>(input(1));
+        const TIn* v = _i420 ? (singlePlane() ? y + 5 * plane_size / 4 : static_cast<const TIn*>(input(2))) : u + 1;
+        const size_t stride_y = singlePlane() ? plane_size * 3 / 2 : plane_size;
+        const size_t stride_uv = singlePlane() ? plane_size * 3 / 2 : (_i420 ? plane_size / 4 : plane_size / 2);
+        const size_t uv_step = _i420 ? 1 : 2;
+        const size_t uv_pitch = _i420 ? width / 2 : width;
+
+        TOut* dst = static_cast<TOut*>(output(0));
+        const size_t pixel_step = fused.planar ? 1 : 3;
+        const size_t channel_step = fused.planar ? plane_size : 1;
+
+        // r, g, b go to the output channels defined by the color format
+        std::array<float, 3> scales, shifts;
+        std::array<size_t, 3> offsets;
+        for (size_t c = 0; c < 3; ++c) {
+            scales[c] = fused.scales[_colorFormat[c]];
+            shifts[c] = fused.shifts[_colorFormat[c]];
+            offsets[c] = _colorFormat[c] * channel_step;
+        }
+
+        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+            const TIn* y_row = y + batch * stride_y + h * width;
+            const TIn* u_row = u + batch * stride_uv + (h / 2) * uv_pitch;
+            const TIn* v_row = v + batch * stride_uv + (h / 2) * uv_pitch;
+            TOut* out = dst + batch * plane_size * 3 + h * width * pixel_step;
+
+            for (size_t w = 0; w < width; w++) {
+                const auto uv_index = (w / 2) * uv_step;
+                TIn r, g, b;
+                std::tie(r, g, b) = yuv_to_rgb<TIn>(static_cast<float>(y_row[w]),
+                                                    static_cast<float>(u_row[uv_index]),
+                                                    static_cast<float>(v_row[uv_index]));
+                const auto pixel = out + w * pixel_step;
+                pixel[offsets[0]] = static_cast<TOut>(static_cast<float>(r) * scales[0] + shifts[0]);
+                pixel[offsets[1]] = static_cast<TOut>(static_cast<float>(g) * scales[1] + shifts[1]);
+                pixel[offsets[2]] = static_cast<TOut>(static_cast<float>(b) * scales[2] + shifts[2]);
+            }
+        });
+    }
+
+private:
+    bool _i420;
+};
+
+}   // namespace fused
+
 /**
  * Implements Color Convert shape inference algorithm. Depending on wether it has only single plain H dimension is
  * passed through or recalculated as 2/3 of the initial size.
@@ -973,15 +1051,16 @@ public:
  */
 class ColorConvertShapeInfer : public ShapeInferEmptyPads {
 public:
-    ColorConvertShapeInfer(bool singlePlain) : m_singlePlain(singlePlain) {}
+    ColorConvertShapeInfer(bool singlePlain, bool planar = false) : m_singlePlain(singlePlain), m_planar(planar) {}
     std::vector<VectorDims> infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
                                   const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
         const auto& dims = input_shapes.front().get();
         if (dims.size() != 4)
             IE_THROW() <<"NV12Converter node has incorrect input dimensions";
-        return m_singlePlain
-                    ? std::vector<VectorDims>{ { dims[Converter::N_DIM], dims[Converter::H_DIM] * 2 / 3, dims[Converter::W_DIM], 3 } }
-                    : std::vector<VectorDims>{ { dims[Converter::N_DIM], dims[Converter::H_DIM], dims[Converter::W_DIM], 3 } };
+        const auto height = m_singlePlain ? dims[Converter::H_DIM] * 2 / 3 : dims[Converter::H_DIM];
+        return m_planar
+                    ? std::vector<VectorDims>{ { dims[Converter::N_DIM], 3, height, dims[Converter::W_DIM] } }
+                    : std::vector<VectorDims>{ { dims[Converter::N_DIM], height, dims[Converter::W_DIM], 3 } };
     }
 
     port_mask_t get_port_mask() const override {
@@ -990,6 +1069,7 @@ public:
 
 private:
     bool m_singlePlain = false;
+    bool m_planar = false;    // NCHW output of the fused preprocessing
 };
 
 class ColorConvertShapeInferFactory : public ShapeInferFactory {
@@ -1049,6 +1129,110 @@ ColorConvert::ColorConvert(const std::shared_ptr<ngraph::Node>& op,
 
 void ColorConvert::getSupportedDescriptors() {}
 
+bool ColorConvert::hasFusedPreprocessing() const {
+    return _fusedPreprocessing.hasScaleShift || _fusedPreprocessing.planar || _fusedPreprocessing.u8ToFP32;
+}
+
+bool ColorConvert::fusePreprocessing(const NodePtr& node) {
+    if (!node->getFusedWith().empty() || node->getChildEdges().empty())
+        return false;
+
+    switch (node->getType()) {
+        case Type::Convert:
+            // the values are rounded as for u8 output anyway, so the conversion to f32 is exact
+            if (getOriginalInputPrecisionAtPort(0) != Precision::U8 ||
+                getOriginalOutputPrecisionAtPort(0) != Precision::U8 ||
+                node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+                return false;
+            _fusedPreprocessing.u8ToFP32 = true;
+            setOriginalOutputPrecisionAtPort(0, Precision::FP32);
+            return true;
+        case Type::Eltwise:
+            return fuseScaleShift(node);
+        case Type::Transpose: {
+            const auto transpose = std::dynamic_pointer_cast<Transpose>(node);
+            const auto orderNode = node->getParentEdgesAtPort(1)[0]->getParent();
+            if (!transpose || _fusedPreprocessing.planar ||
+                orderNode->getType() != Type::Input || !orderNode->isConstant() ||
+                transpose->getOrder() != SizeVector{0, 3, 1, 2})
+                return false;
+            // the single pass conversion is scalar, it pays off only if the values are converted or scaled anyway,
+            // otherwise the jit color conversion followed by Transpose is faster
+            if (!_fusedPreprocessing.u8ToFP32 && !_fusedPreprocessing.hasScaleShift)
+                return false;
+            _fusedPreprocessing.planar = true;
+            outputShapes[0] = node->getOutputShapeAtPort(0);
+            if (shapeInference)
+                shapeInference = std::make_shared<ColorConvertShapeInfer>(getOriginalInputsNumber() == 1, true);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool ColorConvert::fuseScaleShift(const NodePtr& node) {
+    const auto alg = node->getAlgorithm();
+    if (!one_of(alg, Algorithm::EltwiseAdd, Algorithm::EltwiseSubtract, Algorithm::EltwiseMultiply, Algorithm::EltwiseDivide) ||
+        node->getParentEdges().size() != 2 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+
+    const size_t dataPort = node->getParentEdgesAtPort(0)[0]->getParent().get() == this ? 0 : 1;
+    const auto constNode = std::dynamic_pointer_cast<Input>(node->getParentEdgesAtPort(1 - dataPort)[0]->getParent());
+    if (!constNode || !constNode->isConstant() || !constNode->getMemoryPtr() ||
+        constNode->getMemoryPtr()->getDesc().getPrecision() != Precision::FP32 ||
+        (dataPort == 1 && alg == Algorithm::EltwiseDivide))
+        return false;
+
+    // the constant is either a scalar or has the values per channel
+    const auto & outDims = getOutputShapeAtPort(0).getDims();
+    const auto & constDims = constNode->getOutputShapeAtPort(0).getStaticDims();
+    const size_t channelAxis = _fusedPreprocessing.planar ? 1 : 3;
+    if (constDims.size() > outDims.size())
+        return false;
+    bool perChannel = false;
+    for (size_t i = 0; i < constDims.size(); ++i) {
+        const size_t axis = outDims.size() - constDims.size() + i;
+        if (axis == channelAxis && constDims[i] == 3) {
+            perChannel = true;
+        } else if (constDims[i] != 1) {
+            return false;
+        }
+    }
+
+    const auto data = static_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+    auto & scales = _fusedPreprocessing.scales;
+    auto & shifts = _fusedPreprocessing.shifts;
+    for (size_t c = 0; c < 3; ++c) {
+        const float value = data[perChannel ? c : 0];
+        switch (alg) {
+            case Algorithm::EltwiseAdd:
+                shifts[c] += value;
+                break;
+            case Algorithm::EltwiseSubtract:
+                if (dataPort == 0) {
+                    shifts[c] -= value;
+                } else {
+                    scales[c] = -scales[c];
+                    shifts[c] = value - shifts[c];
+                }
+                break;
+            case Algorithm::EltwiseMultiply:
+                scales[c] *= value;
+                shifts[c] *= value;
+                break;
+            default:
+                scales[c] /= value;
+                shifts[c] /= value;
+                break;
+        }
+    }
+    _fusedPreprocessing.hasScaleShift = true;
+    return true;
+}
+
 void ColorConvert::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -1148,6 +1332,16 @@ void ColorConvert::createPrimitive() {
         const auto precision = cfg.inConfs[0].getMemDesc()->getPrecision();
         const bool isSinglePlane = cfg.inConfs.size() == 1;
 
+        if (hasFusedPreprocessing()) {
+            // the fused preprocessing always produces f32 values
+            if (precision == Precision::U8) {
+                _impl.reset(new fused::SinglePassConvert<uint8_t, float>(this));
+            } else {
+                _impl.reset(new fused::SinglePassConvert<float, float>(this));
+            }
+            return;
+        }
+
         _impl = std::unique_ptr<Converter>(_supportedImpls
                                             .at(desc->getImplementationType())
                                             .at(algorithm)
@@ -32,7 +32,33 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * Preprocessing operations absorbed by the color conversion, they are applied to the converted pixel
+     * before it is stored, so the image is read and written only once.
+     */
+    struct FusedPreprocessing {
+        std::array<float, 3> scales = {{1.f, 1.f, 1.f}};   // per output channel, applied before shifts
+        std::array<float, 3> shifts = {{0.f, 0.f, 0.f}};
+        bool hasScaleShift = false;
+        bool planar = false;                                // NCHW output instead of NHWC
+        bool u8ToFP32 = false;                              // u8 input, f32 output
+    };
+
+    /**
+     * @brief Absorbs the child node if it is a part of typical preprocessing: Convert u8->f32, per channel
+     * Add/Subtract/Multiply/Divide with a constant or Transpose NHWC->NCHW. Transpose is absorbed only after
+     * the conversion to f32 or a scale/shift, alone it is done faster by a separate node after the jit conversion.
+     * The caller is responsible for removal of the absorbed node from the graph.
+     * @return false if the node can't be absorbed, the state of the color conversion is not changed then
+     */
+    bool fusePreprocessing(const NodePtr& node);
+    bool hasFusedPreprocessing() const;
+    const FusedPreprocessing& getFusedPreprocessing() const {
+        return _fusedPreprocessing;
+    }
+
 private:
+    bool fuseScaleShift(const NodePtr& node);
     void initSupportedNV12Impls();
     void initSupportedI420Impls();
 
@@ -46,6 +72,7 @@ private:
 
     std::unique_ptr<Converter> _impl;
     SupportedImpls _supportedImpls;
+    FusedPreprocessing _fusedPreprocessing;
 };
 
 class ColorConvert::Converter {
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <vector>
 
 using namespace InferenceEngine;
@@ -32,11 +33,16 @@ struct jit_args_softmax {
     size_t src_stride;
     size_t dst_stride;
     size_t work_amount;
+    const float* scale;
+    const SoftmaxQuantization* quantization;
 };
 
 struct jit_softmax_config_params {
     Precision src_dt;
     Precision dst_dt;
+    bool with_scale;
+    // the output is quantized to u8/i8
+    bool with_quantization;
 };
 
 
@@ -76,6 +82,20 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
         mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
         mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
         mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (jcp_.with_scale) {
+            mov(aux_reg_src, ptr[reg_params + GET_OFF(scale)]);
+            uni_vbroadcastss(vmm_scale, ptr[aux_reg_src]);
+        }
+        if (jcp_.with_quantization) {
+            mov(aux_reg_src, ptr[reg_params + GET_OFF(quantization)]);
+            uni_vbroadcastss(vmm_crop_low, ptr[aux_reg_src + offsetof(SoftmaxQuantization, crop_low)]);
+            uni_vbroadcastss(vmm_crop_high, ptr[aux_reg_src + offsetof(SoftmaxQuantization, crop_high)]);
+            uni_vbroadcastss(vmm_input_scale, ptr[aux_reg_src + offsetof(SoftmaxQuantization, input_scale)]);
+            uni_vbroadcastss(vmm_input_shift, ptr[aux_reg_src + offsetof(SoftmaxQuantization, input_shift)]);
+            uni_vbroadcastss(vmm_output_scale, ptr[aux_reg_src + offsetof(SoftmaxQuantization, output_scale)]);
+            uni_vbroadcastss(vmm_output_shift, ptr[aux_reg_src + offsetof(SoftmaxQuantization, output_shift)]);
+            uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        }
 
         Xbyak::Label max_loop_label;
         Xbyak::Label max_loop_end_label;
@@ -86,12 +106,12 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
 
         mov(aux_reg_work_amount, reg_work_amount);
         mov(aux_reg_src, reg_src);
-        load_vector(vmm_max, ptr[aux_reg_src], jcp_.src_dt);
+        load_src_vector(vmm_max, ptr[aux_reg_src]);
         L(max_loop_label); {
             cmp(aux_reg_work_amount, 0);
             jle(max_loop_end_label, T_NEAR);
 
-            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
+            load_src_vector(vmm_val, ptr[aux_reg_src]);
 
             if (isa == x64::sse41) {
                 uni_vmovups(vmm_mask, vmm_val);
@@ -125,13 +145,15 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
             cmp(aux_reg_work_amount, 0);
             jle(exp_loop_end_label, T_NEAR);
 
-            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
+            load_src_vector(vmm_val, ptr[aux_reg_src]);
 
             uni_vsubps(vmm_val, vmm_val, vmm_max);
             exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
             uni_vaddps(vmm_exp_sum, vmm_exp_sum, vmm_val);
 
-            store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
+            // u8/i8 output can't keep the exponents, they are computed once again in the last loop
+            if (!jcp_.with_quantization)
+                store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
 
             add(aux_reg_src, reg_src_stride);
             add(aux_reg_dst, reg_dst_stride);
@@ -143,17 +165,29 @@ struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_ge
         L(exp_loop_end_label);
 
         mov(aux_reg_work_amount, reg_work_amount);
+        mov(aux_reg_src, reg_src);
         mov(aux_reg_dst, reg_dst);
         L(div_loop_label); {
             cmp(aux_reg_work_amount, 0);
             jle(div_loop_end_label, T_NEAR);
 
-            load_vector(vmm_val, ptr[aux_reg_dst], jcp_.dst_dt);
+            if (jcp_.with_quantization) {
+                load_src_vector(vmm_val, ptr[aux_reg_src]);
+                uni_vsubps(vmm_val, vmm_val, vmm_max);
+                exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            } else {
+                load_vector(vmm_val, ptr[aux_reg_dst], jcp_.dst_dt);
+            }
 
             uni_vdivps(vmm_val, vmm_val, vmm_exp_sum);
 
+            if (jcp_.with_quantization)
+                apply_quantization(vmm_val);
+
             store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
 
+            if (jcp_.with_quantization)
+                add(aux_reg_src, reg_src_stride);
             add(aux_reg_dst, reg_dst_stride);
             sub(aux_reg_work_amount, 1);
 
@@ -188,6 +222,14 @@ private:
     Vmm vmm_val = Vmm(1);
     Vmm vmm_max = Vmm(2);
     Vmm vmm_exp_sum = Vmm(3);
+    Vmm vmm_scale = Vmm(4);
+    Vmm vmm_crop_low = Vmm(5);
+    Vmm vmm_crop_high = Vmm(6);
+    Vmm vmm_input_scale = Vmm(7);
+    Vmm vmm_input_shift = Vmm(8);
+    Vmm vmm_output_scale = Vmm(9);
+    Vmm vmm_output_shift = Vmm(10);
+    Vmm vmm_zero = Vmm(11);
 
     const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
 
@@ -197,6 +239,18 @@ private:
 
     jit_softmax_config_params jcp_;
 
+    inline void load_src_vector(Vmm vmm_src, const Xbyak::Address &op) {
+        load_vector(vmm_src, op, jcp_.src_dt);
+        if (jcp_.with_scale)
+            uni_vmulps(vmm_src, vmm_src, vmm_scale);
+    }
+    inline void apply_quantization(Vmm vmm_dst) {
+        uni_vmaxps(vmm_dst, vmm_dst, vmm_crop_low);
+        uni_vminps(vmm_dst, vmm_dst, vmm_crop_high);
+        uni_vfmadd213ps(vmm_dst, vmm_input_scale, vmm_input_shift);
+        uni_vroundps(vmm_dst, vmm_dst, 0);
+        uni_vfmadd213ps(vmm_dst, vmm_output_scale, vmm_output_shift);
+    }
     inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, Precision src_dt) {
         switch (src_dt) {
             case Precision::FP32:
@@ -206,12 +260,21 @@ private:
                 vpmovzxwd(vmm_src, op);
                 uni_vpslld(vmm_src, vmm_src, 16);
                 break;
+            case Precision::U8:
+                uni_vpmovzxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
             default:
                 assert(!"unknown src_dt");
         }
     }
     inline void store_vector(const Xbyak::Address &op, Vmm vmm_dst, Precision dst_dt) {
         Xbyak::Ymm ymm_dst = Xbyak::Ymm(vmm_dst.getIdx());
+        Xbyak::Xmm xmm_dst = Xbyak::Xmm(vmm_dst.getIdx());
 
         switch (dst_dt) {
             case Precision::FP32:
@@ -221,24 +284,64 @@ private:
                 uni_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
                 vmovdqu16(op, ymm_dst);
                 break;
+            case Precision::U8:
+                uni_vcvtps2dq(vmm_dst, vmm_dst);
+                if (isa == x64::avx512_core) {
+                    vpmaxsd(vmm_dst, vmm_dst, vmm_zero);
+                    vpmovusdb(op, vmm_dst);
+                } else {
+                    uni_vpackusdw(vmm_dst, vmm_dst, vmm_dst);
+                    if (isa != x64::sse41)
+                        vpermq(ymm_dst, ymm_dst, 0x08);
+                    uni_vpackuswb(vmm_dst, vmm_dst, vmm_dst);
+                    if (isa != x64::sse41)
+                        vmovq(op, xmm_dst);
+                    else
+                        movd(op, xmm_dst);
+                }
+                break;
+            case Precision::I8:
+                uni_vcvtps2dq(vmm_dst, vmm_dst);
+                if (isa == x64::avx512_core) {
+                    vpmovsdb(op, vmm_dst);
+                } else {
+                    uni_vpackssdw(vmm_dst, vmm_dst, vmm_dst);
+                    if (isa != x64::sse41)
+                        vpermq(ymm_dst, ymm_dst, 0x08);
+                    uni_vpacksswb(vmm_dst, vmm_dst, vmm_dst);
+                    if (isa != x64::sse41)
+                        vmovq(op, xmm_dst);
+                    else
+                        movd(op, xmm_dst);
+                }
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
     }
 };
 
-SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
-    : input_prec(inpPrc), output_prec(outPrc) {
+SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc, float inpScale,
+                               const SoftmaxQuantization* outQuantization)
+    : input_scale(inpScale), with_quantization(outQuantization != nullptr), output_quantization(),
+      input_prec(inpPrc), output_prec(outPrc) {
     if (Precision::BF16 == output_prec) {
         if (!mayiuse(avx512_core)) {
             IE_THROW() << "SoftmaxGeneric doesn't support BF16 precision on this target.";
         }
     }
+    if (one_of(output_prec, Precision::U8, Precision::I8) != with_quantization) {
+        IE_THROW() << "SoftmaxGeneric supports the output quantization only with u8/i8 output precision.";
+    }
+    if (with_quantization)
+        output_quantization = *outQuantization;
 
     block_size = 1;
     auto jcp = jit_softmax_config_params();
     jcp.src_dt = inpPrc;
     jcp.dst_dt = outPrc;
+    jcp.with_scale = inpScale != 1.f;
+    jcp.with_quantization = with_quantization;
 
     if (mayiuse(x64::avx512_core)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_core>(jcp));
@@ -256,45 +359,69 @@ SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
 
 template<typename in_data_t, typename out_data_t>
 void SoftmaxGeneric::calculate(const in_data_t *src_data, out_data_t *dst_data, int B, int C, int H, int W) {
-    for (int b = 0; b < B; b++) {
-        int tail_start = 0;
-        if (softmax_kernel) {
-            int blocks_num = H*W / block_size;
-
-            parallel_for(blocks_num, [&](int ib) {
-                auto arg = jit_args_softmax();
-
-                arg.src = src_data + b * C * H * W + ib * block_size;
-                arg.dst = dst_data + b * C * H * W + ib * block_size;
-                arg.src_stride = static_cast<size_t>((size_t)(H) * W * sizeof(in_data_t));
-                arg.dst_stride = static_cast<size_t>((size_t)(H) * W * sizeof(out_data_t));
-                arg.work_amount = static_cast<size_t>(C);
+    // the batches are processed in parallel too, e.g. softmax over the innermost axis has a single element in H * W
+    int tail_start = 0;
+    if (softmax_kernel) {
+        int blocks_num = H*W / block_size;
+
+        parallel_for2d(B, blocks_num, [&](int b, int ib) {
+            auto arg = jit_args_softmax();
+
+            arg.src = src_data + b * C * H * W + ib * block_size;
+            arg.dst = dst_data + b * C * H * W + ib * block_size;
+            arg.src_stride = static_cast<size_t>((size_t)(H) * W * sizeof(in_data_t));
+            arg.dst_stride = static_cast<size_t>((size_t)(H) * W * sizeof(out_data_t));
+            arg.work_amount = static_cast<size_t>(C);
+            arg.scale = &input_scale;
+            arg.quantization = &output_quantization;
+
+            (*softmax_kernel)(&arg);
+        });
 
-                (*softmax_kernel)(&arg);
-            });
+        tail_start = (H*W / block_size) * block_size;
+    }
 
-            tail_start = (H*W / block_size) * block_size;
+    parallel_for2d(B, H * W - tail_start, [&](int b, int i) {
+        int offset = i + tail_start;
+        float max = input_scale * src_data[b * C * H * W + offset];
+        for (int c = 0; c < C; c++) {
+            float val = input_scale * src_data[b * C * H * W + c * H * W + offset];
+            if (val > max) max = val;
         }
 
-        parallel_for(H * W - tail_start, [&](int i) {
-            int offset = i + tail_start;
-            float max = src_data[b * C * H * W + offset];
+        float expSum = 0;
+        if (with_quantization) {
             for (int c = 0; c < C; c++) {
-                float val = src_data[b * C * H * W + c * H * W + offset];
-                if (val > max) max = val;
+                expSum += exp(input_scale * src_data[b * C * H * W + c * H * W + offset] - max);
             }
 
-            float expSum = 0;
             for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + offset] = exp(src_data[b * C * H * W + c * H * W + offset] - max);
-                expSum += dst_data[b * C * H * W + c * H * W + offset];
+                const float val = exp(input_scale * src_data[b * C * H * W + c * H * W + offset] - max) / expSum;
+                dst_data[b * C * H * W + c * H * W + offset] = quantize<out_data_t>(val);
             }
+            return;
+        }
 
-            for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + offset] = dst_data[b * C * H * W + c * H * W + offset] / expSum;
-            }
-        });
-    }
+        for (int c = 0; c < C; c++) {
+            dst_data[b * C * H * W + c * H * W + offset] = exp(input_scale * src_data[b * C * H * W + c * H * W + offset] - max);
+            expSum += dst_data[b * C * H * W + c * H * W + offset];
+        }
+
+        for (int c = 0; c < C; c++) {
+            dst_data[b * C * H * W + c * H * W + offset] = dst_data[b * C * H * W + c * H * W + offset] / expSum;
+        }
+    });
+}
+
+template<typename out_data_t>
+out_data_t SoftmaxGeneric::quantize(float value) const {
+    const auto& q = output_quantization;
+    value = std::min(std::max(value, q.crop_low), q.crop_high);
+    value = std::nearbyint(value * q.input_scale + q.input_shift);
+    value = std::nearbyint(value * q.output_scale + q.output_shift);
+    value = std::min(std::max(value, static_cast<float>(std::numeric_limits<out_data_t>::lowest())),
+                     static_cast<float>(std::numeric_limits<out_data_t>::max()));
+    return static_cast<out_data_t>(value);
 }
 
 void SoftmaxGeneric::execute(const uint8_t *src_data, uint8_t *dst_data, int B, int C, int H, int W) {
@@ -320,6 +447,36 @@ void SoftmaxGeneric::execute(const uint8_t *src_data, uint8_t *dst_data, int B,
         } else {
             IE_THROW() << "Unsupported output precision: " << output_prec.name();
         }
+    } else if (Precision::U8 == input_prec) {
+        auto u8_src_data = reinterpret_cast<const uint8_t*>(src_data);
+        if (Precision::FP32 == output_prec) {
+            auto float_dst_data = reinterpret_cast<float*>(dst_data);
+            calculate(u8_src_data, float_dst_data, B, C, H, W);
+        } else if (Precision::BF16 == output_prec) {
+            auto bf16_dst_data = reinterpret_cast<bfloat16_t*>(dst_data);
+            calculate(u8_src_data, bf16_dst_data, B, C, H, W);
+        } else if (Precision::U8 == output_prec) {
+            calculate(u8_src_data, reinterpret_cast<uint8_t*>(dst_data), B, C, H, W);
+        } else if (Precision::I8 == output_prec) {
+            calculate(u8_src_data, reinterpret_cast<int8_t*>(dst_data), B, C, H, W);
+        } else {
+            IE_THROW() << "Unsupported output precision: " << output_prec.name();
+        }
+    } else if (Precision::I8 == input_prec) {
+        auto i8_src_data = reinterpret_cast<const int8_t*>(src_data);
+        if (Precision::FP32 == output_prec) {
+            auto float_dst_data = reinterpret_cast<float*>(dst_data);
+            calculate(i8_src_data, float_dst_data, B, C, H, W);
+        } else if (Precision::BF16 == output_prec) {
+            auto bf16_dst_data = reinterpret_cast<bfloat16_t*>(dst_data);
+            calculate(i8_src_data, bf16_dst_data, B, C, H, W);
+        } else if (Precision::U8 == output_prec) {
+            calculate(i8_src_data, reinterpret_cast<uint8_t*>(dst_data), B, C, H, W);
+        } else if (Precision::I8 == output_prec) {
+            calculate(i8_src_data, reinterpret_cast<int8_t*>(dst_data), B, C, H, W);
+        } else {
+            IE_THROW() << "Unsupported output precision: " << output_prec.name();
+        }
     } else {
         IE_THROW() << "Unsupported input precision: " << input_prec.name();
     }
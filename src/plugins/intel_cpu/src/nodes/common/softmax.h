@@ -39,17 +39,40 @@ void softmax_many_batches(const float *src_data, float *dst_data, int B, int C,
     });
 }
 
+/**
+ * Per tensor FakeQuantize of the softmax output: the value is clamped to [crop_low, crop_high],
+ * multiplied by the input scale, shifted, rounded, and then the output scale and shift are applied.
+ */
+struct SoftmaxQuantization {
+    float crop_low;
+    float crop_high;
+    float input_scale;
+    float input_shift;
+    float output_scale;
+    float output_shift;
+};
+
 class SoftmaxGeneric {
 public:
-    SoftmaxGeneric(InferenceEngine::Precision inpPrc, InferenceEngine::Precision outPrc);
+    /**
+     * @param inpScale scale applied to the input before the computation, e.g. the dequantization scale of int8 data
+     * @param outQuantization quantization of the output, it's required for and only supported with u8/i8 output
+     */
+    SoftmaxGeneric(InferenceEngine::Precision inpPrc, InferenceEngine::Precision outPrc, float inpScale = 1.f,
+                   const SoftmaxQuantization* outQuantization = nullptr);
 
     void execute(const uint8_t *src_data, uint8_t *dst_data, int B, int C, int H, int W);
 private:
     template<typename in_data_t, typename out_data_t>
     void calculate(const in_data_t* src_data, out_data_t* dst_data, int B, int C, int H, int W);
+    template<typename out_data_t>
+    out_data_t quantize(float value) const;
 
 private:
     int block_size;
+    float input_scale;
+    bool with_quantization;
+    SoftmaxQuantization output_quantization;
     InferenceEngine::Precision input_prec, output_prec;
     std::shared_ptr<jit_uni_softmax_kernel> softmax_kernel;
 };
@@ -12,6 +12,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
 #include <dnnl_extension_utils.h>
 #include <onednn/dnnl.h>
 #include "utils/general_utils.h"
@@ -24,6 +25,13 @@
 #include <common/primitive_desc_iface.hpp>
 #include "onednn/dnnl.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "common/blocked_desc_creator.h"
+#include "common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+#include <openvino/core/type/float16.hpp>
+#include "ie_parallel.hpp"
+#include <array>
+#include <algorithm>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -83,6 +91,236 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+// Number of output channels processed by one task of FullyConnected own kernels (weights decompression,
+// block sparse weights). Weights of the block are stored transposed [IC, block], so the innermost loop over
+// the block of output channels has no reduction and is vectorized.
+constexpr size_t refKernelBlockOC = jit_fc_block_oc;
+
+using FCBlockKernels = std::array<std::unique_ptr<jit_uni_fc_block_kernel>, jit_fc_max_rows>;
+using FCFP16Kernels = std::array<std::unique_ptr<jit_uni_fc_f16_kernel>, jit_fc_max_rows>;
+
+struct DecompressionArgs {
+    const uint8_t* weights;
+    const float* scales;
+    const float* zeroPoints;
+    const float* bias;
+    float* buffer;
+    const FCBlockKernels* kernels;
+    const FCFP16Kernels* fp16Kernels;
+    size_t M;
+    size_t OC;
+    size_t IC;
+    size_t groups;
+    bool isSigned;
+    bool packed;
+};
+
+template <bool isSigned, bool packed>
+inline float loadCompressedWeight(const uint8_t* row, size_t ic) {
+    if (packed) {
+        const uint8_t nibble = (row[ic >> 1] >> ((ic & 1) << 2)) & 0x0F;
+        return isSigned ? static_cast<float>(static_cast<int8_t>(nibble << 4) >> 4) : static_cast<float>(nibble);
+    }
+    return isSigned ? static_cast<float>(static_cast<int8_t>(row[ic])) : static_cast<float>(row[ic]);
+}
+
+template <bool isSigned, bool packed>
+void dequantizeWeightsBlock(const DecompressionArgs& args, size_t oc0, size_t ocWork, float* dst) {
+    const size_t rowSize = packed ? args.IC / 2 : args.IC;
+    const size_t groupSize = args.IC / args.groups;
+    for (size_t j = 0; j < refKernelBlockOC; j++) {
+        if (j >= ocWork) {
+            for (size_t ic = 0; ic < args.IC; ic++)
+                dst[ic * refKernelBlockOC + j] = 0.f;
+            continue;
+        }
+        const size_t oc = oc0 + j;
+        const uint8_t* row = args.weights + oc * rowSize;
+        for (size_t g = 0; g < args.groups; g++) {
+            const float scale = args.scales[oc * args.groups + g];
+            const float zeroPoint = args.zeroPoints ? args.zeroPoints[oc * args.groups + g] : 0.f;
+            for (size_t ic = g * groupSize; ic < (g + 1) * groupSize; ic++)
+                dst[ic * refKernelBlockOC + j] = (loadCompressedWeight<isSigned, packed>(row, ic) - zeroPoint) * scale;
+        }
+    }
+}
+
+template <typename TI>
+void multiplyRowsByWeightsBlockRef(const TI* src, size_t IC, const float* weights, size_t rows, float* acc) {
+    for (size_t r = 0; r < rows; r++) {
+        const TI* srcRow = src + r * IC;
+        float* accRow = acc + r * refKernelBlockOC;
+        for (size_t ic = 0; ic < IC; ic++) {
+            const float value = static_cast<float>(srcRow[ic]);
+            const float* w = weights + ic * refKernelBlockOC;
+            for (size_t j = 0; j < refKernelBlockOC; j++)
+                accRow[j] += value * w[j];
+        }
+    }
+}
+
+// All the rows of the source are multiplied by the block of weights [IC, refKernelBlockOC], several rows at once,
+// so the weights are loaded once for all of them
+template <typename TI, typename TO>
+void multiplyByWeightsBlock(const TI* src, TO* dst, const float* weights, const DecompressionArgs& args,
+                            size_t oc0, size_t ocWork) {
+    for (size_t m = 0; m < args.M; m += jit_fc_max_rows) {
+        const size_t rows = std::min(jit_fc_max_rows, args.M - m);
+        float acc[jit_fc_max_rows * refKernelBlockOC] = {};
+        const auto& kernel = (*args.kernels)[rows - 1];
+        if (kernel) {
+            jit_fc_block_call_args callArgs;
+            callArgs.src = src + m * args.IC;
+            callArgs.weights = weights;
+            callArgs.indices = nullptr;
+            callArgs.dst = acc;
+            callArgs.src_stride = args.IC * sizeof(TI);
+            callArgs.k = args.IC;
+            (*kernel)(&callArgs);
+        } else {
+            multiplyRowsByWeightsBlockRef(src + m * args.IC, args.IC, weights, rows, acc);
+        }
+
+        for (size_t r = 0; r < rows; r++) {
+            TO* dstRow = dst + (m + r) * args.OC + oc0;
+            const float* accRow = acc + r * refKernelBlockOC;
+            for (size_t j = 0; j < ocWork; j++)
+                dstRow[j] = static_cast<TO>(args.bias ? accRow[j] + args.bias[oc0 + j] : accRow[j]);
+        }
+    }
+}
+
+template <typename TI, typename TO>
+void executeDecompressedFC(const TI* src, TO* dst, const DecompressionArgs& args) {
+    using dequantizeFunc = void (*)(const DecompressionArgs&, size_t, size_t, float*);
+    const dequantizeFunc dequantize = args.isSigned ? (args.packed ? dequantizeWeightsBlock<true, true> : dequantizeWeightsBlock<true, false>)
+                                                    : (args.packed ? dequantizeWeightsBlock<false, true> : dequantizeWeightsBlock<false, false>);
+
+    parallel_for(div_up(args.OC, refKernelBlockOC), [&](size_t blockOC) {
+        const size_t oc0 = blockOC * refKernelBlockOC;
+        const size_t ocWork = std::min(refKernelBlockOC, args.OC - oc0);
+        float* weights = args.buffer + parallel_get_thread_num() * args.IC * refKernelBlockOC;
+        // weights are dequantized once per block and reused for all the rows of the source
+        dequantize(args, oc0, ocWork, weights);
+        multiplyByWeightsBlock(src, dst, weights, args, oc0, ocWork);
+    });
+}
+
+// FP16 weights are multiplied as they are stored [OC, IC], the kernel converts them to fp32 in registers.
+// The input channels beyond the multiple of the vector length and the odd output channel are added by the loop.
+template <typename TI, typename TO>
+void executeFP16WeightsFC(const TI* src, TO* dst, const DecompressionArgs& args) {
+    const auto weights = reinterpret_cast<const ov::float16*>(args.weights);
+    parallel_for(div_up(args.OC, refKernelBlockOC), [&](size_t blockOC) {
+        const size_t oc0 = blockOC * refKernelBlockOC;
+        const size_t ocWork = std::min(refKernelBlockOC, args.OC - oc0);
+        for (size_t m = 0; m < args.M; m += jit_fc_max_rows) {
+            const size_t rows = std::min(jit_fc_max_rows, args.M - m);
+            float acc[jit_fc_max_rows * refKernelBlockOC] = {};
+            const auto& kernel = (*args.fp16Kernels)[rows - 1];
+            size_t icDone = 0;
+            size_t ocDone = 0;
+            if (kernel) {
+                icDone = args.IC / kernel->k_step_ * kernel->k_step_;
+                for (; ocDone + jit_fc_f16_ocs <= ocWork; ocDone += jit_fc_f16_ocs) {
+                    jit_fc_f16_call_args callArgs;
+                    callArgs.src = src + m * args.IC;
+                    callArgs.weights = weights + (oc0 + ocDone) * args.IC;
+                    callArgs.dst = acc + ocDone;
+                    callArgs.src_stride = args.IC * sizeof(TI);
+                    callArgs.weights_stride = args.IC * sizeof(ov::float16);
+                    callArgs.k = icDone;
+                    (*kernel)(&callArgs);
+                }
+            }
+
+            for (size_t r = 0; r < rows; r++) {
+                const TI* srcRow = src + (m + r) * args.IC;
+                for (size_t j = 0; j < ocWork; j++) {
+                    const ov::float16* weightsRow = weights + (oc0 + j) * args.IC;
+                    float sum = 0.f;
+                    for (size_t ic = j < ocDone ? icDone : 0; ic < args.IC; ic++)
+                        sum += static_cast<float>(srcRow[ic]) * static_cast<float>(weightsRow[ic]);
+                    acc[r * refKernelBlockOC + j] += sum;
+                }
+            }
+
+            for (size_t r = 0; r < rows; r++) {
+                TO* dstRow = dst + (m + r) * args.OC + oc0;
+                const float* accRow = acc + r * refKernelBlockOC;
+                for (size_t j = 0; j < ocWork; j++)
+                    dstRow[j] = static_cast<TO>(args.bias ? accRow[j] + args.bias[oc0 + j] : accRow[j]);
+            }
+        }
+    });
+}
+
+struct BlockSparseArgs {
+    const int32_t* offsets;
+    const int32_t* indices;
+    const float* values;
+    const float* bias;
+    const FCBlockKernels* kernels;
+    size_t M;
+    size_t OC;
+    size_t IC;
+};
+
+template <typename TI>
+void multiplyRowsBySparseBlockRef(const TI* src, size_t IC, const int32_t* indices, const float* values, size_t k,
+                                  size_t rows, float* acc) {
+    for (size_t r = 0; r < rows; r++) {
+        const TI* srcRow = src + r * IC;
+        float* accRow = acc + r * refKernelBlockOC;
+        for (size_t i = 0; i < k; i++) {
+            const float value = static_cast<float>(srcRow[indices[i]]);
+            const float* w = values + i * refKernelBlockOC;
+            for (size_t j = 0; j < refKernelBlockOC; j++)
+                accRow[j] += value * w[j];
+        }
+    }
+}
+
+// Only input channels with non zero weights of the block of output channels are accumulated,
+// the weights of such input channel are stored contiguously for all the output channels of the block.
+// Several rows of the source are multiplied at once, so the weights are loaded once for all of them.
+template <typename TI, typename TO>
+void executeBlockSparseFC(const TI* src, TO* dst, const BlockSparseArgs& args) {
+    parallel_for(div_up(args.OC, refKernelBlockOC), [&](size_t blockOC) {
+        const size_t oc0 = blockOC * refKernelBlockOC;
+        const size_t ocWork = std::min(refKernelBlockOC, args.OC - oc0);
+        const int32_t begin = args.offsets[blockOC];
+        const size_t k = static_cast<size_t>(args.offsets[blockOC + 1] - begin);
+        const int32_t* indices = args.indices + begin;
+        const float* values = args.values + begin * refKernelBlockOC;
+
+        for (size_t m = 0; m < args.M; m += jit_fc_max_rows) {
+            const size_t rows = std::min(jit_fc_max_rows, args.M - m);
+            float acc[jit_fc_max_rows * refKernelBlockOC] = {};
+            const auto& kernel = (*args.kernels)[rows - 1];
+            if (kernel) {
+                jit_fc_block_call_args callArgs;
+                callArgs.src = src + m * args.IC;
+                callArgs.weights = values;
+                callArgs.indices = indices;
+                callArgs.dst = acc;
+                callArgs.src_stride = args.IC * sizeof(TI);
+                callArgs.k = k;
+                (*kernel)(&callArgs);
+            } else {
+                multiplyRowsBySparseBlockRef(src + m * args.IC, args.IC, indices, values, k, rows, acc);
+            }
+
+            for (size_t r = 0; r < rows; r++) {
+                TO* dstRow = dst + (m + r) * args.OC + oc0;
+                const float* accRow = acc + r * refKernelBlockOC;
+                for (size_t j = 0; j < ocWork; j++)
+                    dstRow[j] = static_cast<TO>(args.bias ? accRow[j] + args.bias[oc0 + j] : accRow[j]);
+            }
+        }
+    });
+}
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -174,7 +412,14 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // weights decompression is executed by the node itself, so there are no oneDNN descriptors
+    if (withWeightsDecompression())
+        return;
+
     useSparseWeights = useSparseWeightsDecompression();
+    blockSparseWeights = !useSparseWeights && useBlockSparseWeights();
+    if (blockSparseWeights)
+        return;
 
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
@@ -229,6 +474,10 @@ void FullyConnected::prepareParams() {
             IE_THROW() << "Input memory hasn't been allocated.";
     }
 
+    // own kernels don't depend on the shape of the source
+    if (useRefKernels())
+        return;
+
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
@@ -422,6 +671,15 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (withWeightsDecompression()) {
+        executeWithWeightsDecompression();
+        return;
+    }
+    if (blockSparseWeights) {
+        executeWithBlockSparseWeights();
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -451,6 +709,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the kernel with weights decompression doesn't support post ops
+    if (withWeightsDecompression())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -613,6 +874,9 @@ void FullyConnected::createDescriptorInternal(const dnnl::memory::desc &inputDes
 
 void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useRefKernels())
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -634,6 +898,11 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useRefKernels()) {
+        initRefSupportedPrimitiveDescriptors();
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -725,6 +994,8 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
 
 void FullyConnected::initOptimalPrimitiveDescriptor() {
     Node::initOptimalPrimitiveDescriptor();
+    if (useRefKernels())
+        return;
     auto selectedPD = getSelectedPrimitiveDescriptor();
     implementationTypeIP = selectedPD->getImplementationType();
     // if convolution selected the reorder for ip is useless. Will do the reoder for ip in prepareParams
@@ -952,6 +1223,385 @@ bool FullyConnected::useSparseWeightsDecompression() {
     return true;
 }
 
+bool FullyConnected::useBlockSparseWeights() {
+    // minSparseRate == 1 means that sparse feature is switched off
+    if (minSparseRate == 1.f || !fusedWith.empty())
+        return false;
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    if (weiDims.size() != 2 || !one_of(getOriginalInputPrecisionAtPort(DATA_ID), Precision::FP32, Precision::BF16))
+        return false;
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode)
+        return false;
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+    if (blb->getDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    // pruned input or output channels give blocks of zero weights [blockOC x 1], which are skipped by the kernel
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const size_t blocksOC = div_up(OC, refKernelBlockOC);
+    const auto weightsData = reinterpret_cast<const float*>(blb->GetPtr());
+    // there is no point in skipping the blocks when the sparse rate is low
+    const float minBlockSparseRate = std::max(minSparseRate, 0.5f);
+    auto sparseRate = [IC](size_t nonZeroBlocks, size_t blocks) {
+        return 1.f - static_cast<float>(nonZeroBlocks) / static_cast<float>(blocks * IC);
+    };
+
+    // the rows of the block are read contiguously, the input channels with non zero weights are marked
+    std::vector<uint8_t> nonZero(IC);
+    auto collectIndices = [&](size_t b, std::vector<int32_t>& indices) {
+        std::fill(nonZero.begin(), nonZero.end(), 0);
+        for (size_t oc = b * refKernelBlockOC; oc < std::min(OC, (b + 1) * refKernelBlockOC); oc++) {
+            const float* row = weightsData + oc * IC;
+            for (size_t ic = 0; ic < IC; ic++)
+                nonZero[ic] |= row[ic] != 0.f;
+        }
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (nonZero[ic])
+                indices.push_back(static_cast<int32_t>(ic));
+        }
+    };
+
+    // dense weights are rejected by a few evenly spaced blocks before all the weights are scanned,
+    // the pruning may be not uniform, so only the weights far below the threshold are rejected this way
+    constexpr size_t sampleBlocks = 8;
+    if (blocksOC > sampleBlocks) {
+        std::vector<int32_t> sampleIndices;
+        for (size_t s = 0; s < sampleBlocks; s++)
+            collectIndices(s * blocksOC / sampleBlocks, sampleIndices);
+        const float sampleSparseRate = sparseRate(sampleIndices.size(), sampleBlocks);
+        if (sampleSparseRate < minBlockSparseRate / 2) {
+            DEBUG_LOG(getName(), " | sampled block sparse rate = ", sampleSparseRate * 100, "%, min sparse rate = ",
+                minBlockSparseRate * 100, "%, use block sparse weights = 0");
+            return false;
+        }
+    }
+
+    std::vector<int32_t> offsets(blocksOC + 1, 0);
+    std::vector<int32_t> indices;
+    for (size_t b = 0; b < blocksOC; b++) {
+        collectIndices(b, indices);
+        offsets[b + 1] = static_cast<int32_t>(indices.size());
+        // the non zero blocks are only added, so the scan is stopped once the rate is below the threshold
+        if (sparseRate(indices.size(), blocksOC) < minBlockSparseRate)
+            break;
+    }
+
+    weiSparseRate = sparseRate(indices.size(), blocksOC);
+
+    DEBUG_LOG(getName(), " | block sparse rate = ", weiSparseRate * 100, "%, min sparse rate = ",
+        minBlockSparseRate * 100, "%, use block sparse weights = ", weiSparseRate >= minBlockSparseRate);
+
+    if (weiSparseRate < minBlockSparseRate)
+        return false;
+
+    blockSparseOffsets = std::move(offsets);
+    blockSparseIndices = std::move(indices);
+    return true;
+}
+
+void FullyConnected::prepareBlockSparseWeights() {
+    if (blockSparseValues)
+        return;
+
+    auto weightsMemPtr = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    const auto& weiDims = weightsMemPtr->getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const auto weightsData = reinterpret_cast<const float*>(weightsMemPtr->GetPtr());
+
+    auto create = [&] () {
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine());
+        const size_t valuesCount = std::max(blockSparseIndices.size(), size_t{1}) * refKernelBlockOC;
+        ptr->Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{valuesCount})));
+        auto values = reinterpret_cast<float*>(ptr->GetPtr());
+        parallel_for(blockSparseOffsets.size() - 1, [&](size_t b) {
+            for (int32_t k = blockSparseOffsets[b]; k < blockSparseOffsets[b + 1]; k++) {
+                const size_t ic = blockSparseIndices[k];
+                for (size_t j = 0; j < refKernelBlockOC; j++) {
+                    const size_t oc = b * refKernelBlockOC + j;
+                    values[k * refKernelBlockOC + j] = oc < OC ? weightsData[oc * IC + ic] : 0.f;
+                }
+            }
+        });
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_block_sparse_" + std::to_string(blockSparseIndices.size())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weightsData));
+        blockSparseValues = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        blockSparseValues = create();
+    }
+}
+
+void FullyConnected::executeWithBlockSparseWeights() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto& srcDims = srcMemPtr->getStaticDims();
+
+    BlockSparseArgs args;
+    args.offsets = blockSparseOffsets.data();
+    args.indices = blockSparseIndices.data();
+    args.values = reinterpret_cast<const float*>(blockSparseValues->GetPtr());
+    args.kernels = &blockKernels;
+    args.bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+    args.M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    args.OC = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr()->getStaticDims()[0];
+    args.IC = srcDims.back();
+
+    const auto srcPtr = srcMemPtr->GetPtr();
+    const auto dstPtr = dstMemPtr->GetPtr();
+    const bool srcBF16 = srcMemPtr->getDesc().getPrecision() == Precision::BF16;
+    const bool dstBF16 = dstMemPtr->getDesc().getPrecision() == Precision::BF16;
+    if (srcBF16 && dstBF16) {
+        executeBlockSparseFC(reinterpret_cast<const bfloat16_t*>(srcPtr), reinterpret_cast<bfloat16_t*>(dstPtr), args);
+    } else if (srcBF16) {
+        executeBlockSparseFC(reinterpret_cast<const bfloat16_t*>(srcPtr), reinterpret_cast<float*>(dstPtr), args);
+    } else if (dstBF16) {
+        executeBlockSparseFC(reinterpret_cast<const float*>(srcPtr), reinterpret_cast<bfloat16_t*>(dstPtr), args);
+    } else {
+        executeBlockSparseFC(reinterpret_cast<const float*>(srcPtr), reinterpret_cast<float*>(dstPtr), args);
+    }
+}
+
+void FullyConnected::createBlockKernels() {
+    const auto srcPrecision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[DATA_ID].getMemDesc()->getPrecision();
+    const bool fp16Weights = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::FP16;
+    // vcvtph2ps is a part of AVX-512, AVX2 machines must support F16C
+    const bool hasF16C = impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C);
+    for (size_t rows = 1; rows <= jit_fc_max_rows; rows++) {
+        jit_fc_block_config_params jcp;
+        jcp.rows = rows;
+        jcp.src_bf16 = srcPrecision == Precision::BF16;
+        jcp.sparse = blockSparseWeights;
+        if (fp16Weights) {
+            auto& kernel = fp16Kernels[rows - 1];
+            if (kernel)
+                continue;
+            if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+                kernel.reset(new jit_uni_fc_f16_kernel_f32<impl::cpu::x64::avx512_core>(jcp));
+            } else if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx2) && hasF16C) {
+                kernel.reset(new jit_uni_fc_f16_kernel_f32<impl::cpu::x64::avx2>(jcp));
+            }
+            if (kernel)
+                kernel->create_ker();
+        } else {
+            auto& kernel = blockKernels[rows - 1];
+            if (kernel)
+                continue;
+            if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+                kernel.reset(new jit_uni_fc_block_kernel_f32<impl::cpu::x64::avx512_core>(jcp));
+            } else if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx2)) {
+                kernel.reset(new jit_uni_fc_block_kernel_f32<impl::cpu::x64::avx2>(jcp));
+            }
+            if (kernel)
+                kernel->create_ker();
+        }
+    }
+}
+
+void FullyConnected::createPrimitive() {
+    if (withWeightsDecompression()) {
+        prepareWeightsDecompression();
+        createBlockKernels();
+    }
+    if (blockSparseWeights) {
+        prepareBlockSparseWeights();
+        createBlockKernels();
+    }
+    Node::createPrimitive();
+}
+
+void FullyConnected::fuseDecompressionMultiply(const NodePtr& constData) {
+    fuseDecompressionConstant(constData, decompressionMultiply);
+}
+
+void FullyConnected::fuseDecompressionSubtract(const NodePtr& constData) {
+    fuseDecompressionConstant(constData, decompressionSubtract);
+}
+
+void FullyConnected::fuseDecompressionConstant(const NodePtr& constData, std::vector<float>& decompressionValues) {
+    auto *constInputNode = dynamic_cast<node::Input *>(constData.get());
+    if (!constInputNode) {
+        IE_THROW() << errorPrefix << " has unexpected decompression constant node " << constData->getName();
+    }
+    auto constBlob = constInputNode->getMemoryPtr();
+    const auto elementsCount = constBlob->GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+    decompressionValues.resize(elementsCount);
+    cpu_convert(constBlob->GetPtr(),
+                decompressionValues.data(),
+                constBlob->getDesc().getPrecision(),
+                Precision::FP32,
+                elementsCount);
+}
+
+void FullyConnected::initRefSupportedPrimitiveDescriptors() {
+    auto inputPrecision = getOriginalInputPrecisionAtPort(DATA_ID);
+    if (inputPrecision != Precision::BF16)
+        inputPrecision = Precision::FP32;
+    auto outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (outputPrecision != Precision::BF16)
+        outputPrecision = Precision::FP32;
+
+    const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
+    NodeConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        // compressed weights are consumed as is, block sparse weights are packed from fp32 ones
+        const auto weightsPrecision = withWeightsDecompression() ? getOriginalInputPrecisionAtPort(WEIGHTS_ID) : Precision::FP32;
+        const auto precision = i == DATA_ID ? inputPrecision :
+                               i == WEIGHTS_ID ? weightsPrecision : Precision::FP32;
+        PortConfig portConfig;
+        portConfig.inPlace(-1);
+        portConfig.constant(false);
+        portConfig.setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(precision, getInputShapeAtPort(i)));
+        config.inConfs.push_back(portConfig);
+    }
+
+    PortConfig portConfig;
+    portConfig.inPlace(-1);
+    portConfig.constant(false);
+    portConfig.setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(outputPrecision, getOutputShapeAtPort(0)));
+    config.outConfs.push_back(portConfig);
+
+    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref_any);
+}
+
+void FullyConnected::prepareWeightsDecompression() {
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+
+    // scales and zero points are broadcasted to [OC, G] with the same number of groups G
+    auto getGroups = [OC](const std::vector<float>& values) {
+        return values.size() <= 1 ? size_t{1} : values.size() / OC;
+    };
+    decompressionGroups = std::max(getGroups(decompressionMultiply), getGroups(decompressionSubtract));
+    if (IC % decompressionGroups != 0)
+        IE_THROW() << errorPrefix << " has unsupported number of decompression groups: " << decompressionGroups;
+
+    auto broadcast = [&](std::vector<float>& values) {
+        const size_t groups = getGroups(values);
+        if (values.empty() || (values.size() == OC * decompressionGroups && groups == decompressionGroups))
+            return;
+        if (decompressionGroups % groups != 0)
+            IE_THROW() << errorPrefix << " has inconsistent decompression groups: " << groups << " and " << decompressionGroups;
+        std::vector<float> broadcasted(OC * decompressionGroups);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t g = 0; g < decompressionGroups; g++) {
+                broadcasted[oc * decompressionGroups + g] =
+                    values.size() == 1 ? values[0] : values[oc * groups + g * groups / decompressionGroups];
+            }
+        }
+        values = std::move(broadcasted);
+    };
+    broadcast(decompressionMultiply);
+    broadcast(decompressionSubtract);
+
+    // fp16 weights are converted in registers without the buffer
+    if (getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::FP16)
+        return;
+
+    if (!packedWeights)
+        packWeightsTo4Bit();
+
+    // per thread block of dequantized weights
+    const size_t bufferSize = parallel_get_max_threads() * IC * refKernelBlockOC;
+    decompressionBuffer = getRuntimeScratchPad()->createScratchPadMem(
+        std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{bufferSize})));
+}
+
+void FullyConnected::packWeightsTo4Bit() {
+    auto weightsMemPtr = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    const auto& weightsDims = weightsMemPtr->getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    if (IC % 2 != 0)
+        return;
+
+    // packing is lossless only if all the values fit into 4 bits, which is the case for u4/i4 weights
+    // unpacked to u8/i8 by the precision conversion
+    const bool isSigned = weightsMemPtr->getDesc().getPrecision() == Precision::I8;
+    const auto weightsData = reinterpret_cast<const uint8_t*>(weightsMemPtr->GetPtr());
+    const size_t elementsCount = OC * IC;
+    for (size_t i = 0; i < elementsCount; i++) {
+        const int value = isSigned ? static_cast<int>(static_cast<int8_t>(weightsData[i])) : static_cast<int>(weightsData[i]);
+        if (isSigned ? (value < -8 || value > 7) : value > 15)
+            return;
+    }
+
+    auto create = [&] () {
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine());
+        ptr->Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{OC, IC / 2})));
+        auto packedData = reinterpret_cast<uint8_t*>(ptr->GetPtr());
+        parallel_for(elementsCount / 2, [&](size_t i) {
+            packedData[i] = static_cast<uint8_t>((weightsData[2 * i] & 0x0F) | (weightsData[2 * i + 1] << 4));
+        });
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_packed4bit_" + std::to_string(elementsCount)
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weightsData));
+        packedWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        packedWeights = create();
+    }
+}
+
+void FullyConnected::executeWithWeightsDecompression() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    auto weightsMemPtr = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    const auto& srcDims = srcMemPtr->getStaticDims();
+
+    DecompressionArgs args;
+    args.weights = reinterpret_cast<const uint8_t*>(packedWeights ? packedWeights->GetPtr() : weightsMemPtr->GetPtr());
+    args.scales = decompressionMultiply.empty() ? nullptr : decompressionMultiply.data();
+    args.zeroPoints = decompressionSubtract.empty() ? nullptr : decompressionSubtract.data();
+    args.bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+    args.buffer = decompressionBuffer ? reinterpret_cast<float*>(decompressionBuffer->GetPtr()) : nullptr;
+    args.kernels = &blockKernels;
+    args.fp16Kernels = &fp16Kernels;
+    args.M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    args.OC = weightsMemPtr->getStaticDims()[0];
+    args.IC = srcDims.back();
+    args.groups = decompressionGroups;
+    args.isSigned = weightsMemPtr->getDesc().getPrecision() == Precision::I8;
+    args.packed = packedWeights != nullptr;
+
+    const auto srcPtr = srcMemPtr->GetPtr();
+    const auto dstPtr = dstMemPtr->GetPtr();
+    const bool srcBF16 = srcMemPtr->getDesc().getPrecision() == Precision::BF16;
+    const bool dstBF16 = dstMemPtr->getDesc().getPrecision() == Precision::BF16;
+    if (weightsMemPtr->getDesc().getPrecision() == Precision::FP16) {
+        if (srcBF16 && dstBF16) {
+            executeFP16WeightsFC(reinterpret_cast<const bfloat16_t*>(srcPtr), reinterpret_cast<bfloat16_t*>(dstPtr), args);
+        } else if (srcBF16) {
+            executeFP16WeightsFC(reinterpret_cast<const bfloat16_t*>(srcPtr), reinterpret_cast<float*>(dstPtr), args);
+        } else if (dstBF16) {
+            executeFP16WeightsFC(reinterpret_cast<const float*>(srcPtr), reinterpret_cast<bfloat16_t*>(dstPtr), args);
+        } else {
+            executeFP16WeightsFC(reinterpret_cast<const float*>(srcPtr), reinterpret_cast<float*>(dstPtr), args);
+        }
+    } else if (srcBF16 && dstBF16) {
+        executeDecompressedFC(reinterpret_cast<const bfloat16_t*>(srcPtr), reinterpret_cast<bfloat16_t*>(dstPtr), args);
+    } else if (srcBF16) {
+        executeDecompressedFC(reinterpret_cast<const bfloat16_t*>(srcPtr), reinterpret_cast<float*>(dstPtr), args);
+    } else if (dstBF16) {
+        executeDecompressedFC(reinterpret_cast<const float*>(srcPtr), reinterpret_cast<bfloat16_t*>(dstPtr), args);
+    } else {
+        executeDecompressedFC(reinterpret_cast<const float*>(srcPtr), reinterpret_cast<float*>(dstPtr), args);
+    }
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -6,10 +6,12 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "kernels/fc_block_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -42,7 +44,7 @@ public:
 
     void initSupportedPrimitiveDescriptors() override;
     void initOptimalPrimitiveDescriptor() override;
-    // void createPrimitive() override;
+    void createPrimitive() override;
     std::shared_ptr<MemoryDesc> getSrcMemDesc(dnnl::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
     std::shared_ptr<MemoryDesc> getDstMemDesc(dnnl::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
@@ -61,6 +63,13 @@ public:
 
     void setMinSparseRate(float sparseRate) { minSparseRate = sparseRate; }
 
+    void fuseDecompressionConvert() { weightsDecompression = true; }
+    void fuseDecompressionMultiply(const NodePtr& constData);
+    void fuseDecompressionSubtract(const NodePtr& constData);
+    bool withWeightsDecompression() const { return weightsDecompression; }
+    // the node is executed by its own kernels instead of oneDNN primitives
+    bool useRefKernels() const { return withWeightsDecompression() || blockSparseWeights; }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -116,6 +125,36 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+
+    // block sparse weights for fp32 / bf16 activations
+    bool useBlockSparseWeights();
+    void prepareBlockSparseWeights();
+    void executeWithBlockSparseWeights();
+    bool blockSparseWeights = false;
+    // input channels with non zero weights for each block of output channels and offsets of the blocks in it
+    std::vector<int32_t> blockSparseOffsets;
+    std::vector<int32_t> blockSparseIndices;
+    MemoryPtr blockSparseValues;
+
+    void initRefSupportedPrimitiveDescriptors();
+    void createBlockKernels();
+    // jit kernels of own implementations for each number of source rows processed at once
+    std::array<std::unique_ptr<jit_uni_fc_block_kernel>, jit_fc_max_rows> blockKernels;
+    std::array<std::unique_ptr<jit_uni_fc_f16_kernel>, jit_fc_max_rows> fp16Kernels;
+
+    // weights decompression
+    void fuseDecompressionConstant(const NodePtr& constData, std::vector<float>& decompressionValues);
+    void prepareWeightsDecompression();
+    void executeWithWeightsDecompression();
+    void packWeightsTo4Bit();
+    bool weightsDecompression = false;
+    // decompression scales and zero points are stored per output channel and group of input channels: [OC, G]
+    std::vector<float> decompressionMultiply;
+    std::vector<float> decompressionSubtract;
+    size_t decompressionGroups = 1;
+    // weights which values fit into 4 bits are kept packed, two values per byte
+    MemoryPtr packedWeights;
+    MemoryPtr decompressionBuffer;
 };
 
 }   // namespace node
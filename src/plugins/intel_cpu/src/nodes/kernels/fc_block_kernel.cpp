@@ -0,0 +1,225 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_block_kernel.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_fc_block_call_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_fc_block_kernel_f32<isa>::jit_uni_fc_block_kernel_f32(const jit_fc_block_config_params& jcp)
+    : jit_uni_fc_block_kernel(jcp), jit_generator(jit_name()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_block_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_block_kernel_f32<isa>::load_weights(const Vmm& vmm, const Xbyak::RegExp& addr) {
+    uni_vmovups(vmm, ptr[addr]);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_block_kernel_f32<isa>::broadcast_src(const Vmm& vmm, const Xbyak::RegExp& addr) {
+    if (jcp_.src_bf16) {
+        // bf16 is the upper half of fp32
+        vpbroadcastw(vmm, word[addr]);
+        uni_vpslld(vmm, vmm, 16);
+    } else {
+        uni_vbroadcastss(vmm, ptr[addr]);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_block_kernel_f32<isa>::generate() {
+    const size_t src_size = jcp_.src_bf16 ? sizeof(uint16_t) : sizeof(float);
+    const size_t weights_size = sizeof(float);
+
+    this->preamble();
+
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_k, ptr[reg_params + GET_OFF(k)]);
+    mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+    mov(reg_src[0], ptr[reg_params + GET_OFF(src)]);
+    for (size_t r = 1; r < jcp_.rows; r++)
+        lea(reg_src[r], ptr[reg_src[r - 1] + reg_src_stride]);
+    if (jcp_.sparse)
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+
+    for (size_t r = 0; r < jcp_.rows; r++) {
+        for (size_t v = 0; v < vecs_per_block; v++)
+            uni_vpxor(vmm_acc(r, v), vmm_acc(r, v), vmm_acc(r, v));
+    }
+
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    L(loop_label);
+    {
+        cmp(reg_k, 0);
+        je(loop_end_label, T_NEAR);
+
+        for (size_t v = 0; v < vecs_per_block; v++)
+            load_weights(vmm_weights(v), reg_weights + v * simd_w * weights_size);
+
+        if (jcp_.sparse)
+            movsxd(reg_ic, dword[reg_indices]);
+
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            if (jcp_.sparse)
+                broadcast_src(vmm_src, reg_src[r] + reg_ic * static_cast<int>(src_size));
+            else
+                broadcast_src(vmm_src, reg_src[r]);
+            for (size_t v = 0; v < vecs_per_block; v++)
+                uni_vfmadd231ps(vmm_acc(r, v), vmm_weights(v), vmm_src);
+        }
+
+        add(reg_weights, jit_fc_block_oc * weights_size);
+        if (jcp_.sparse) {
+            add(reg_indices, sizeof(int32_t));
+        } else {
+            for (size_t r = 0; r < jcp_.rows; r++)
+                add(reg_src[r], src_size);
+        }
+
+        dec(reg_k);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+
+    for (size_t r = 0; r < jcp_.rows; r++) {
+        for (size_t v = 0; v < vecs_per_block; v++)
+            uni_vmovups(ptr[reg_dst + (r * jit_fc_block_oc + v * simd_w) * sizeof(float)], vmm_acc(r, v));
+    }
+
+    this->postamble();
+}
+
+template struct jit_uni_fc_block_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_fc_block_kernel_f32<cpu::x64::avx512_core>;
+
+#define GET_OFF_F16(field) offsetof(jit_fc_f16_call_args, field)
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_fc_f16_kernel_f32<isa>::jit_uni_fc_f16_kernel_f32(const jit_fc_block_config_params& jcp)
+    : jit_uni_fc_f16_kernel(jcp, simd_w), jit_generator(jit_name()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_f16_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_f16_kernel_f32<isa>::load_src(const Vmm& vmm, const Xbyak::Reg64& reg) {
+    if (jcp_.src_bf16) {
+        // bf16 is the upper half of fp32
+        if (isa == cpu::x64::avx512_core)
+            vpmovzxwd(vmm, yword[reg]);
+        else
+            vpmovzxwd(vmm, xword[reg]);
+        uni_vpslld(vmm, vmm, 16);
+    } else {
+        uni_vmovups(vmm, ptr[reg]);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_f16_kernel_f32<isa>::load_weights(const Vmm& vmm, const Xbyak::Reg64& reg) {
+    if (isa == cpu::x64::avx512_core)
+        vcvtph2ps(vmm, yword[reg]);
+    else
+        vcvtph2ps(vmm, xword[reg]);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_f16_kernel_f32<isa>::reduce(const Vmm& vmm, const Vmm& vmm_tmp) {
+    const Xbyak::Ymm ymm = Xbyak::Ymm(vmm.getIdx());
+    const Xbyak::Ymm ymm_tmp = Xbyak::Ymm(vmm_tmp.getIdx());
+    const Xbyak::Xmm xmm = Xbyak::Xmm(vmm.getIdx());
+    const Xbyak::Xmm xmm_tmp = Xbyak::Xmm(vmm_tmp.getIdx());
+    if (isa == cpu::x64::avx512_core) {
+        vextractf64x4(ymm_tmp, Xbyak::Zmm(vmm.getIdx()), 1);
+        vaddps(ymm, ymm, ymm_tmp);
+    }
+    vextractf128(xmm_tmp, ymm, 1);
+    vaddps(xmm, xmm, xmm_tmp);
+    vhaddps(xmm, xmm, xmm);
+    vhaddps(xmm, xmm, xmm);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_fc_f16_kernel_f32<isa>::generate() {
+    const size_t src_size = jcp_.src_bf16 ? sizeof(uint16_t) : sizeof(float);
+    const size_t weights_size = sizeof(uint16_t);
+
+    this->preamble();
+
+    mov(reg_dst, ptr[reg_params + GET_OFF_F16(dst)]);
+    mov(reg_k, ptr[reg_params + GET_OFF_F16(k)]);
+    mov(reg_src_stride, ptr[reg_params + GET_OFF_F16(src_stride)]);
+    mov(reg_weights_stride, ptr[reg_params + GET_OFF_F16(weights_stride)]);
+    mov(reg_src[0], ptr[reg_params + GET_OFF_F16(src)]);
+    for (size_t r = 1; r < jcp_.rows; r++)
+        lea(reg_src[r], ptr[reg_src[r - 1] + reg_src_stride]);
+    mov(reg_weights[0], ptr[reg_params + GET_OFF_F16(weights)]);
+    for (size_t j = 1; j < jit_fc_f16_ocs; j++)
+        lea(reg_weights[j], ptr[reg_weights[j - 1] + reg_weights_stride]);
+
+    for (size_t r = 0; r < jcp_.rows; r++) {
+        for (size_t j = 0; j < jit_fc_f16_ocs; j++)
+            uni_vpxor(vmm_acc(r, j), vmm_acc(r, j), vmm_acc(r, j));
+    }
+
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    L(loop_label);
+    {
+        cmp(reg_k, simd_w);
+        jl(loop_end_label, T_NEAR);
+
+        for (size_t j = 0; j < jit_fc_f16_ocs; j++)
+            load_weights(vmm_weights(j), reg_weights[j]);
+
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            load_src(vmm_src, reg_src[r]);
+            for (size_t j = 0; j < jit_fc_f16_ocs; j++)
+                uni_vfmadd231ps(vmm_acc(r, j), vmm_weights(j), vmm_src);
+        }
+
+        for (size_t j = 0; j < jit_fc_f16_ocs; j++)
+            add(reg_weights[j], simd_w * weights_size);
+        for (size_t r = 0; r < jcp_.rows; r++)
+            add(reg_src[r], simd_w * src_size);
+
+        sub(reg_k, simd_w);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+
+    for (size_t r = 0; r < jcp_.rows; r++) {
+        for (size_t j = 0; j < jit_fc_f16_ocs; j++) {
+            reduce(vmm_acc(r, j), vmm_src);
+            vmovss(ptr[reg_dst + (r * jit_fc_block_oc + j) * sizeof(float)], Xbyak::Xmm(vmm_acc(r, j).getIdx()));
+        }
+    }
+
+    this->postamble();
+}
+
+template struct jit_uni_fc_f16_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_fc_f16_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,163 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+// Number of output channels in the block of weights processed by the kernel
+constexpr size_t jit_fc_block_oc = 16;
+// Max number of source rows processed by the kernel at once, the weights are loaded once for all of them
+constexpr size_t jit_fc_max_rows = 4;
+
+struct jit_fc_block_config_params {
+    size_t rows;
+    bool src_bf16;
+    // only the input channels listed in the indices are accumulated (block sparse weights)
+    bool sparse = false;
+};
+
+/**
+ * The kernel multiplies the block of source rows by the block of weights stored transposed [k, jit_fc_block_oc]:
+ * dst[r][j] = sum_i src[r][i] * weights[i][j], the sums are kept in registers for all the rows of the block.
+ * The sparse kernel reads the i-th weights row for the input channel indices[i] of the source.
+ */
+struct jit_fc_block_call_args {
+    const void* src;
+    const void* weights;
+    const int32_t* indices;
+    float* dst;
+    size_t src_stride;  // in bytes
+    size_t k;
+};
+
+struct jit_uni_fc_block_kernel {
+    void (*ker_)(const jit_fc_block_call_args*);
+
+    void operator()(const jit_fc_block_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_block_kernel(const jit_fc_block_config_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_block_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_block_config_params jcp_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_fc_block_kernel_f32 : public jit_uni_fc_block_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_block_kernel_f32)
+
+    explicit jit_uni_fc_block_kernel_f32(const jit_fc_block_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static constexpr size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    static constexpr size_t simd_w = vlen / sizeof(float);
+    static constexpr size_t vecs_per_block = jit_fc_block_oc / simd_w;
+
+    void load_weights(const Vmm& vmm, const Xbyak::RegExp& addr);
+    void broadcast_src(const Vmm& vmm, const Xbyak::RegExp& addr);
+
+    Vmm vmm_acc(size_t row, size_t vec) const {
+        return Vmm(static_cast<int>(row * vecs_per_block + vec));
+    }
+    Vmm vmm_weights(size_t vec) const {
+        return Vmm(static_cast<int>(jit_fc_max_rows * vecs_per_block + vec));
+    }
+    Vmm vmm_src = Vmm(static_cast<int>((jit_fc_max_rows + 1) * vecs_per_block));
+
+    const Xbyak::Reg64 reg_src[jit_fc_max_rows] = {r8, r9, r10, r11};
+    Xbyak::Reg64 reg_weights = r12;
+    Xbyak::Reg64 reg_indices = r13;
+    Xbyak::Reg64 reg_k = r14;
+    Xbyak::Reg64 reg_ic = r15;
+    Xbyak::Reg64 reg_dst = rax;
+    Xbyak::Reg64 reg_src_stride = rbx;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+};
+
+// Number of fp16 weights rows (output channels) processed by the fp16 kernel at once
+constexpr size_t jit_fc_f16_ocs = 2;
+
+/**
+ * The kernel multiplies the block of source rows by jit_fc_f16_ocs rows of fp16 weights [OC, IC] as they are
+ * stored in the model: the weights are converted to fp32 right after the load, so they are never stored
+ * decompressed. Only the input channels up to the multiple of the vector length are processed (k),
+ * dst[r * jit_fc_block_oc + j] is the sum of the products of the r-th source row and the j-th weights row.
+ */
+struct jit_fc_f16_call_args {
+    const void* src;
+    const void* weights;
+    float* dst;
+    size_t src_stride;      // in bytes
+    size_t weights_stride;  // in bytes
+    size_t k;
+};
+
+struct jit_uni_fc_f16_kernel {
+    void (*ker_)(const jit_fc_f16_call_args*);
+
+    void operator()(const jit_fc_f16_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_fc_f16_kernel(const jit_fc_block_config_params& jcp, size_t k_step) : ker_(nullptr), jcp_(jcp), k_step_(k_step) {}
+    virtual ~jit_uni_fc_f16_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_block_config_params jcp_;
+    // the number of the input channels processed by the kernel must be a multiple of it
+    size_t k_step_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_fc_f16_kernel_f32 : public jit_uni_fc_f16_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_f16_kernel_f32)
+
+    explicit jit_uni_fc_f16_kernel_f32(const jit_fc_block_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static constexpr size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    static constexpr size_t simd_w = vlen / sizeof(float);
+
+    void load_src(const Vmm& vmm, const Xbyak::Reg64& reg);
+    void load_weights(const Vmm& vmm, const Xbyak::Reg64& reg);
+    void reduce(const Vmm& vmm, const Vmm& vmm_tmp);
+
+    Vmm vmm_acc(size_t row, size_t oc) const {
+        return Vmm(static_cast<int>(row * jit_fc_f16_ocs + oc));
+    }
+    Vmm vmm_weights(size_t oc) const {
+        return Vmm(static_cast<int>(jit_fc_max_rows * jit_fc_f16_ocs + oc));
+    }
+    Vmm vmm_src = Vmm(static_cast<int>((jit_fc_max_rows + 1) * jit_fc_f16_ocs));
+
+    const Xbyak::Reg64 reg_src[jit_fc_max_rows] = {r8, r9, r10, r11};
+    const Xbyak::Reg64 reg_weights[jit_fc_f16_ocs] = {r12, r13};
+    Xbyak::Reg64 reg_k = r14;
+    Xbyak::Reg64 reg_weights_stride = r15;
+    Xbyak::Reg64 reg_dst = rax;
+    Xbyak::Reg64 reg_src_stride = rbx;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
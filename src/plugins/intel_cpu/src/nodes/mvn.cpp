@@ -5,6 +5,7 @@
 #include "mvn.h"
 
 #include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -2002,6 +2003,26 @@ void MVN::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* dst_data, co
     }
 }
 
+bool MVN::fuseInputScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts) {
+    if (!mvnAttrs.normalizeVariance_ || scales.empty())
+        return false;
+    // the shift is removed together with the mean only if it's the same for all the normalized values
+    if (shifts.size() > 1 && mvnAttrs.initAcrossChannels_)
+        return false;
+    // mvn(-x) == -mvn(x), so only the positive scale is absorbed
+    const float scale = scales[0];
+    if (!(scale > 0.f) || std::any_of(scales.begin(), scales.end(), [scale](float s) { return s != scale; }))
+        return false;
+
+    // (x * scale - mean) / sqrt(var * scale^2 + eps) == (x - mean) / sqrt(var + eps / scale^2)
+    const float eps = mvnAttrs.epsValue_ / (mvnAttrs.epsMode_ == INSIDE_SQRT ? scale * scale : scale);
+    if (mvnAttrs.epsValue_ != 0.f && !std::isnormal(eps))
+        return false;
+
+    mvnAttrs.epsValue_ = eps;
+    return true;
+}
+
 bool MVN::canFuse(const NodePtr& node) const {
     if (!mayiuse(cpu::x64::sse41)) {
         return false;
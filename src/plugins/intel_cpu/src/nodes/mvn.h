@@ -100,6 +100,10 @@ public:
         return mvnAttrs.normalizeVariance_;
     }
 
+    // Absorbs the transformation scale * x + shift of the input, e.g. dequantization of int8 data.
+    // The normalized values don't depend on it except for epsilon, which is rescaled.
+    bool fuseInputScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts);
+
     bool canFuse(const NodePtr& node) const override;
     void prepareParams() override;
 
@@ -5,6 +5,9 @@
 #include "softmax.h"
 
 #include <string>
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include <memory_desc/cpu_memory_desc_utils.h>
@@ -12,9 +15,12 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
 #include <utils/shape_inference/shape_inference_pass_through.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include "fake_quantize.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -89,6 +95,10 @@ void SoftMax::getSupportedDescriptors() {
     if (!getChildEdges().size())
         IE_THROW() << "Incorrect number of output edges for layer " << getName();
 
+    int8Input = one_of(getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8);
+    if (int8Input)
+        return;
+
     const auto &inShape = getInputShapeAtPort(0);
     if (inShape.getRank() == 3) {
         auto in_candidate = std::make_shared<DnnlBlockedMemoryDesc>(inShape, inputDataType, memory::format_tag::abc);
@@ -105,6 +115,67 @@ void SoftMax::getSupportedDescriptors() {
     }
 }
 
+void SoftMax::initSupportedPrimitiveDescriptors() {
+    if (!int8Input) {
+        Node::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (!fusedWith.empty())
+        outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
+    if (!one_of(outputPrecision, Precision::U8, Precision::I8) &&
+        (outputPrecision != Precision::BF16 || !mayiuse(avx512_core)))
+        outputPrecision = Precision::FP32;
+
+    impl_desc_type impl_type;
+    if (mayiuse(avx512_core)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, getOriginalInputPrecisionAtPort(0)}},
+                         {{LayoutType::ncsp, outputPrecision}},
+                         impl_type);
+}
+
+bool SoftMax::canFuseInputScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts) const {
+    // softmax(s * x + b) == softmax(s * x) if b is the same along the axis
+    if (scales.empty() || std::any_of(scales.begin(), scales.end(), [&](float scale) { return scale != scales[0]; }))
+        return false;
+
+    // the scales and the shifts are either scalar or per channel
+    const bool perChannelShift =
+        std::any_of(shifts.begin(), shifts.end(), [&](float shift) { return shift != shifts[0]; });
+    return !perChannelShift || (axis != 1 && getInputShapeAtPort(0).getRank() >= 2);
+}
+
+bool SoftMax::fuseInputScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts) {
+    if (!canFuseInputScaleShift(scales, shifts))
+        return false;
+
+    inputScale *= scales[0];
+    return true;
+}
+
+bool SoftMax::canFuse(const NodePtr& node) const {
+    // the output is quantized by the kernel processing int8 input, the probabilities are fused with FakeQuantize only
+    if (!fusedWith.empty() || !one_of(getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8))
+        return false;
+
+    const auto fakeQuantize = std::dynamic_pointer_cast<FakeQuantize>(node);
+    return fakeQuantize && !fakeQuantize->isBinarization() &&
+           fakeQuantize->getBroadcastingPolicy() == FakeQuantize::PerTensor &&
+           one_of(fakeQuantize->getOriginalOutputPrecisionAtPort(0), Precision::U8, Precision::I8);
+}
+
 bool SoftMax::created() const {
     return getType() == Type::Softmax;
 }
@@ -113,6 +184,10 @@ void SoftMax::initOptimalPrimitiveDescriptor() {
     auto selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
+    if (int8Input) {
+        Node::initOptimalPrimitiveDescriptor();
+        return;
+    }
     auto config = selected_pd->getConfig();
     if (isDynamicNode()) {
         auto outMemDesc = config.outConfs[0].getMemDesc();
@@ -131,6 +206,9 @@ void SoftMax::initOptimalPrimitiveDescriptor() {
 
 void SoftMax::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                          const std::vector<MemoryDescPtr> &outputDesc) {
+    if (int8Input)
+        return;
+
     auto inpDesc = inputDesc[0]->isDefined() ? inputDesc[0] : MemoryDescUtils::makeDummyDesc(*inputDesc[0]);
     DnnlMemoryDescPtr definedInpMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(inpDesc);
     auto in_candidate = definedInpMemDesc->getDnnlDesc();
@@ -141,6 +219,29 @@ void SoftMax::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
 }
 
 void SoftMax::prepareParams() {
+    if (int8Input) {
+        if (!int8Executor) {
+            const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+            std::unique_ptr<SoftmaxQuantization> outputQuantization;
+            if (!fusedWith.empty()) {
+                const auto fakeQuantize = std::dynamic_pointer_cast<FakeQuantize>(fusedWith[0]);
+                if (!fakeQuantize)
+                    IE_THROW() << "Unexpected node " << fusedWith[0]->getName() << " fused with " << getName();
+                outputQuantization.reset(new SoftmaxQuantization{fakeQuantize->getCropLow()[0],
+                                                                 fakeQuantize->getCropHigh()[0],
+                                                                 fakeQuantize->getInputScale()[0],
+                                                                 fakeQuantize->getInputShift()[0],
+                                                                 fakeQuantize->getOutputScale()[0],
+                                                                 fakeQuantize->getOutputShift()[0]});
+            }
+            int8Executor = std::make_shared<SoftmaxGeneric>(config.inConfs[0].getMemDesc()->getPrecision(),
+                                                            config.outConfs[0].getMemDesc()->getPrecision(),
+                                                            inputScale,
+                                                            outputQuantization.get());
+        }
+        return;
+    }
+
     auto inpDesc = getParentEdgeAt(0)->getMemory().GetDescWithType<DnnlMemoryDesc>();
     const NodeDesc* selected_pd = getSelectedPrimitiveDescriptor();
 
@@ -191,6 +292,20 @@ void SoftMax::prepareParams() {
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}, {DNNL_ARG_SCRATCHPAD, scratchpadMem->GetPrimitive()}};
 }
 
+void SoftMax::execute(dnnl::stream strm) {
+    if (!int8Executor) {
+        Node::execute(strm);
+        return;
+    }
+
+    const auto& dims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto outer = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const auto inner = std::accumulate(dims.begin() + axis + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+    const auto src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    int8Executor->execute(src, dst, static_cast<int>(outer), static_cast<int>(dims[axis]), static_cast<int>(inner), 1);
+}
+
 void SoftMax::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <nodes/common/softmax.h>
 
 namespace ov {
 namespace intel_cpu {
@@ -22,15 +23,34 @@ public:
     void createDescriptor(const std::vector<MemoryDescPtr>& inputDesc,
                           const std::vector<MemoryDescPtr>& outputDesc) override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     bool created() const override;
+    bool canFuse(const NodePtr& node) const override;
+
+    /**
+     * Checks if the transformation scale * x + shift of the input can be absorbed: the shift must be the same along
+     * the softmax axis, and the scale must be the same for all the elements.
+     */
+    bool canFuseInputScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts) const;
+    /**
+     * Absorbs the transformation scale * x + shift of the input, so the node can take int8 data directly.
+     * @return false if the transformation can't be absorbed
+     */
+    bool fuseInputScaleShift(const std::vector<float>& scales, const std::vector<float>& shifts);
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
     void prepareParams() override;
+    void execute(dnnl::stream strm) override;
     void executeDynamicImpl(dnnl::stream strm) override;
 
 private:
     size_t axis = 0;
+    // int8 input is processed by the jit kernel with fp32 accumulation, since oneDNN softmax supports only fp data,
+    // the kernel also quantizes the output to u8/i8 if FakeQuantize is fused
+    bool int8Input = false;
+    float inputScale = 1.f;
+    std::shared_ptr<SoftmaxGeneric> int8Executor;
 };
 
 }   // namespace node
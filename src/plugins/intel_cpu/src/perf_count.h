@@ -6,6 +6,7 @@
 
 #include <chrono>
 #include <ratio>
+#include "perf_events.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -17,6 +18,11 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    HwPerfEvents::Values hw_start = {};
+    HwPerfEvents::Values hw_last = {};
+    HwPerfEvents::Values hw_total = {};
+    uint32_t hw_num = 0;
+
 public:
     PerfCount(): total_duration(0), num(0) {}
 
@@ -24,18 +30,36 @@ public:
         return __finish - __start;
     }
 
+    std::chrono::high_resolution_clock::time_point start() const { return __start; }
+    std::chrono::high_resolution_clock::time_point finish() const { return __finish; }
+
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
     uint32_t count() const { return num; }
 
+    bool hasHwCounters() const { return hw_num != 0; }
+    uint64_t hwAvg(HwPerfEvents::Counter counter) const { return (hw_num == 0) ? 0 : hw_total[counter] / hw_num; }
+    // hardware counters of the last iteration
+    const HwPerfEvents::Values& hwLast() const { return hw_last; }
+
 private:
-    void start_itr() {
+    void start_itr(const HwPerfEvents::ThreadCounters* events) {
+        if (events)
+            hw_start = events->readCurrent();
         __start = std::chrono::high_resolution_clock::now();
     }
 
-    void finish_itr() {
+    void finish_itr(const HwPerfEvents::ThreadCounters* events) {
         __finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+        if (events) {
+            const auto hw_finish = events->readCurrent();
+            for (size_t i = 0; i < HwPerfEvents::CountersNum; i++) {
+                hw_last[i] = hw_finish[i] - hw_start[i];
+                hw_total[i] += hw_last[i];
+            }
+            hw_num++;
+        }
     }
 
     friend class PerfHelper;
@@ -43,11 +67,14 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    const HwPerfEvents::ThreadCounters* events;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, const HwPerfEvents::ThreadCounters* hwEvents = nullptr): counter(count), events(hwEvents) {
+        counter.start_itr(events);
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() { counter.finish_itr(events); }
 };
 
 }   // namespace intel_cpu
@@ -55,3 +82,5 @@ public:
 
 #define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
 #define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_PERF_HW(_node, _events) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter(), _events))
+#define PERF_HW(_node, _need, _events) auto pc = _need ? GET_PERF_HW(_node, _events) : nullptr;
@@ -0,0 +1,311 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_events.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <unordered_map>
+
+#include <ie_parallel.hpp>
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_scheduler_observer.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#ifdef __linux__
+static int openPerfEvent(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // pid = 0, cpu = -1: the calling thread on any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static inline uint64_t rdpmc(uint32_t counter) {
+    uint32_t low, high;
+    __asm__ volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(counter));
+    return static_cast<uint64_t>(low) | (static_cast<uint64_t>(high) << 32);
+}
+
+// The self-monitoring read described in linux/perf_event.h: the page is updated by the kernel under the seqlock
+static bool readMmapPage(const void* page, uint64_t& value) {
+    const volatile auto* pc = static_cast<const volatile perf_event_mmap_page*>(page);
+    uint32_t seq;
+    do {
+        seq = pc->lock;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        const uint32_t index = pc->index;
+        if (!pc->cap_user_rdpmc || index == 0)
+            return false;
+        const uint16_t width = pc->pmc_width;
+        // sign extension of the pmc_width bits value
+        const int64_t count = static_cast<int64_t>(rdpmc(index - 1) << (64 - width)) >> (64 - width);
+        value = static_cast<uint64_t>(pc->offset + count);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    } while (pc->lock != seq);
+    return true;
+}
+#endif
+#endif
+
+HwPerfEvents::ThreadCounters::~ThreadCounters() {
+#ifdef __linux__
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for (size_t i = 0; i < CountersNum; i++) {
+        if (pages[i])
+            munmap(pages[i], pageSize);
+        if (fds[i] != -1)
+            close(fds[i]);
+    }
+#endif
+}
+
+bool HwPerfEvents::ThreadCounters::open() {
+#ifdef __linux__
+    static const std::array<uint64_t, CountersNum> configs = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES
+    };
+    for (size_t i = 0; i < CountersNum; i++) {
+        fds[i] = openPerfEvent(configs[i], i == 0 ? -1 : fds[0]);
+        if (fds[i] == -1)
+            return false;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for (size_t i = 0; i < CountersNum; i++) {
+        void* page = mmap(nullptr, pageSize, PROT_READ, MAP_SHARED, fds[i], 0);
+        if (page == MAP_FAILED)
+            break;
+        pages[i] = page;
+    }
+    // user space reading is used only if it's allowed for all the counters
+    for (auto page : pages) {
+        if (!page || !static_cast<const perf_event_mmap_page*>(page)->cap_user_rdpmc) {
+            for (auto& p : pages) {
+                if (p)
+                    munmap(p, pageSize);
+                p = nullptr;
+            }
+            break;
+        }
+    }
+#endif
+    return true;
+#else
+    return false;
+#endif
+}
+
+HwPerfEvents::Values HwPerfEvents::ThreadCounters::readCurrent() const {
+#if defined(__linux__) && (defined(__x86_64__) || defined(__i386__))
+    if (pages[0]) {
+        Values result;
+        bool success = true;
+        for (size_t i = 0; i < CountersNum && success; i++)
+            success = readMmapPage(pages[i], result[i]);
+        // the counter may be not scheduled on the PMU at the moment, the kernel knows its value then
+        if (success)
+            return result;
+    }
+#endif
+    return read();
+}
+
+HwPerfEvents::Values HwPerfEvents::ThreadCounters::read() const {
+    Values result{};
+#ifdef __linux__
+    // PERF_FORMAT_GROUP layout: number of counters followed by their values
+    std::array<uint64_t, CountersNum + 1> buffer;
+    if (::read(fds[0], buffer.data(), sizeof(buffer)) == sizeof(buffer)) {
+        for (size_t i = 0; i < CountersNum; i++)
+            result[i] = buffer[i + 1];
+    }
+#endif
+    return result;
+}
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+// Registers the threads joining the arena the observer is created in
+struct HwPerfEvents::ThreadsObserver : public tbb::task_scheduler_observer {
+    ThreadsObserver(tbb::task_arena& arena, HwPerfEvents& events)
+        : tbb::task_scheduler_observer(arena), events(events) {
+        observe(true);
+    }
+
+    ~ThreadsObserver() override {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        events.registerCurrentThread();
+    }
+
+    HwPerfEvents& events;
+};
+#else
+struct HwPerfEvents::ThreadsObserver {};
+#endif
+
+HwPerfEvents::Ptr HwPerfEvents::create() {
+    std::shared_ptr<HwPerfEvents> events(new HwPerfEvents());
+    if (!events->registerCurrentThread())
+        return nullptr;
+    return events;
+}
+
+HwPerfEvents::~HwPerfEvents() {
+    // no threads are registered after the observer is destroyed
+    observer.reset();
+}
+
+const HwPerfEvents::ThreadCounters* HwPerfEvents::registerCurrentThread() {
+    const auto id = std::this_thread::get_id();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = threads.find(id);
+        if (found != threads.end())
+            return found->second.get();
+    }
+    std::unique_ptr<ThreadCounters> counters(new ThreadCounters());
+    // a thread without available counters is just not taken into account
+    if (!counters->open())
+        return nullptr;
+    std::lock_guard<std::mutex> lock(mutex);
+    return threads.emplace(id, std::move(counters)).first->second.get();
+}
+
+void HwPerfEvents::registerWorkerThreads() {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!observer) {
+        tbb::task_arena arena(tbb::task_arena::attach{});
+        observer.reset(new ThreadsObserver(arena, *this));
+    }
+#endif
+    // the threads which are already in the arena or in the OMP team
+    parallel_nt(0, [&](const int, const int) {
+        registerCurrentThread();
+    });
+}
+
+HwPerfEvents::Values HwPerfEvents::read() const {
+    Values result{};
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& thread : threads) {
+        const auto values = thread.second->read();
+        for (size_t i = 0; i < CountersNum; i++)
+            result[i] += values[i];
+    }
+    return result;
+}
+
+const char* HwPerfEvents::name(Counter counter) {
+    switch (counter) {
+        case Cycles: return "cycles";
+        case Instructions: return "instructions";
+        case LLCMisses: return "llc_misses";
+        default: return "unknown";
+    }
+}
+
+PerfTrace::Ptr PerfTrace::get(const std::string& path) {
+    static std::mutex tracesMutex;
+    static std::unordered_map<std::string, std::weak_ptr<PerfTrace>> traces;
+
+    std::lock_guard<std::mutex> lock(tracesMutex);
+    auto trace = traces[path].lock();
+    if (!trace) {
+        trace = std::shared_ptr<PerfTrace>(new PerfTrace(path));
+        traces[path] = trace;
+    }
+    return trace;
+}
+
+int PerfTrace::registerSource(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    sources.push_back(name);
+    return static_cast<int>(sources.size() - 1);
+}
+
+void PerfTrace::addEvents(int sourceId, std::vector<Event>& newEvents) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& event : newEvents) {
+        if (events.size() >= maxEventsNum)
+            break;
+        events.emplace_back(sourceId, std::move(event));
+    }
+    newEvents.clear();
+}
+
+static std::string escapeJson(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (auto c : str) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20)
+            result += c;
+    }
+    return result;
+}
+
+PerfTrace::~PerfTrace() {
+    std::ofstream out(path);
+    if (!out.is_open())
+        return;
+
+    auto toUs = [](Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+    auto origin = Clock::time_point::max();
+    for (const auto& item : events)
+        origin = std::min(origin, item.second.start);
+
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (size_t i = 0; i < sources.size(); i++) {
+        out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i
+            << ",\"args\":{\"name\":\"" << escapeJson(sources[i]) << "\"}}";
+        first = false;
+    }
+    for (const auto& item : events) {
+        const auto& event = item.second;
+        out << (first ? "" : ",\n") << "{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\"" << escapeJson(event.type)
+            << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << item.first
+            << ",\"ts\":" << toUs(event.start - origin) << ",\"dur\":" << toUs(event.finish - event.start);
+        if (event.hasHwValues) {
+            out << ",\"args\":{";
+            for (size_t i = 0; i < HwPerfEvents::CountersNum; i++) {
+                out << (i ? "," : "") << "\"" << HwPerfEvents::name(static_cast<HwPerfEvents::Counter>(i)) << "\":"
+                    << event.hwValues[i];
+            }
+            out << "}";
+        }
+        out << "}";
+        first = false;
+    }
+    out << "\n]}\n";
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
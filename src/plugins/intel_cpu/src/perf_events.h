@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Hardware performance counters of the threads executing the graph.
+ * Implemented over Linux perf_event_open: a group of counters is opened for every registered thread.
+ * The counters of a node are read by the thread executing the graph from its own group in user space (rdpmc)
+ * without locks and syscalls. The totals of all the threads, including the workers of parallel_for, are read
+ * with syscalls, so it is meant to be done once per inference.
+ */
+class HwPerfEvents {
+public:
+    enum Counter : size_t {
+        Cycles = 0,
+        Instructions,
+        LLCMisses,
+        CountersNum
+    };
+    using Values = std::array<uint64_t, CountersNum>;
+    using Ptr = std::shared_ptr<HwPerfEvents>;
+
+    /**
+     * @brief Counters of a single thread
+     */
+    class ThreadCounters {
+    public:
+        ~ThreadCounters();
+
+        /**
+         * @brief Reads the counters in user space when rdpmc is allowed, otherwise with one read() syscall
+         * @note Must be called by the thread the counters are opened for
+         */
+        Values readCurrent() const;
+
+        /**
+         * @brief Reads the counters with one read() syscall, can be called by any thread
+         */
+        Values read() const;
+
+    private:
+        ThreadCounters() = default;
+        bool open();
+
+        std::array<int, CountersNum> fds = {-1, -1, -1};
+        // perf_event_mmap_page of every counter, nullptr if rdpmc is not allowed
+        std::array<void*, CountersNum> pages = {};
+        friend class HwPerfEvents;
+    };
+
+    /**
+     * @brief Creates counters for the calling thread
+     * @return nullptr if the counters are not available (not Linux OS, restricted by perf_event_paranoid, no PMU in VM)
+     */
+    static Ptr create();
+
+    ~HwPerfEvents();
+
+    /**
+     * @brief Opens counters for the calling thread, does nothing if the thread is already registered
+     * @return counters of the calling thread or nullptr if they can't be opened
+     */
+    const ThreadCounters* registerCurrentThread();
+
+    /**
+     * @brief Registers the threads which may execute parallel regions of the calling thread: the workers of
+     * the current TBB arena (including the ones joining it later) or the threads of the OMP team
+     */
+    void registerWorkerThreads();
+
+    /**
+     * @brief Sum of the counters over all the registered threads
+     */
+    Values read() const;
+
+    static const char* name(Counter counter);
+
+private:
+    HwPerfEvents() = default;
+
+    struct ThreadsObserver;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadCounters>> threads;
+    std::unique_ptr<ThreadsObserver> observer;
+};
+
+/**
+ * @brief Chrome trace (chrome://tracing, Perfetto) writer.
+ * Graphs of all the streams of the compiled model share one trace object per file path. Each graph collects
+ * its events locally without locking and passes them to the trace in bulk. The file is written when
+ * the last graph releases the trace.
+ */
+class PerfTrace {
+public:
+    using Ptr = std::shared_ptr<PerfTrace>;
+    using Clock = std::chrono::high_resolution_clock;
+
+    struct Event {
+        std::string name;
+        std::string type;
+        Clock::time_point start;
+        Clock::time_point finish;
+        HwPerfEvents::Values hwValues;
+        bool hasHwValues;
+    };
+
+    static Ptr get(const std::string& path);
+
+    ~PerfTrace();
+
+    /**
+     * @brief Returns new unique id of events source (it is shown as a separate track in the trace)
+     */
+    int registerSource(const std::string& name);
+
+    void addEvents(int sourceId, std::vector<Event>& events);
+
+    // Limits memory consumed by the trace, the rest events are dropped
+    static constexpr size_t maxEventsNum = 1000000;
+
+private:
+    explicit PerfTrace(std::string path) : path(std::move(path)) {}
+
+    std::string path;
+    std::mutex mutex;
+    std::vector<std::string> sources;
+    std::vector<std::pair<int, Event>> events;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
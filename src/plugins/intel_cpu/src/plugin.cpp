@@ -13,6 +13,8 @@
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <fstream>
@@ -81,6 +83,7 @@
 #include <transformations/init_node_info.hpp>
 #include <transformations/disable_decompression_convert_constant_folding.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/decompression.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
 #include <transformations/op_conversions/convert_roi_align_v9_to_v3.hpp>
@@ -90,6 +93,7 @@
 #include "transformations/op_conversions/unique_decomposition.hpp"
 
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/convert_matmul_to_fc.hpp"
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
 #include "ngraph_transformations/mha_fusion.hpp"
 #include "ngraph_transformations/convert_to_interaction.hpp"
@@ -286,7 +290,7 @@ static bool fuse_type_to_convert(const std::shared_ptr<ngraph::Node>& node, ov::
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT, const bool _enableBF16,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool isLegacyApi, const bool _keepFP16Weights) {
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ov::pass::InitNodeInfo>();
@@ -306,6 +310,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
             defaultPrecisions = ngraph::pass::low_precision::precision_set::int8_int16_int32_support;
         }
         manager.register_pass<ov::pass::MarkDequantizationSubgraph>(defaultPrecisions);
+    } else {
+        // Keep compressed weights of MatMul unfolded, the decompression is fused into FullyConnected node.
+        // u4/i4 weights are unpacked to u8/i8 by ConvertPrecision below.
+        manager.register_pass<ov::pass::MarkDequantizationSubgraph>(ov::element::TypeVector{
+            ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4});
     }
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -492,10 +501,57 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         pass_config->set_callback<ov::pass::ConvertMatrixNmsToMatrixNmsIE>(nmsCallback);
     }
 
+    if (!useLpt) {
+        // Only MatMul weights (maybe through Reshape) are decompressed on the fly
+        pass_config->set_callback<ov::pass::MarkDequantizationSubgraph>(
+            [](const_node_ptr &node) -> bool {
+                for (const auto& target : node->get_output_target_inputs(0)) {
+                    auto consumer = target.get_node();
+                    auto port = target.get_index();
+                    if (ov::is_type<ov::opset10::Reshape>(consumer) && consumer->get_output_target_inputs(0).size() == 1) {
+                        const auto reshapeTarget = *consumer->get_output_target_inputs(0).begin();
+                        consumer = reshapeTarget.get_node();
+                        port = reshapeTarget.get_index();
+                    }
+                    if (!ov::is_type<ov::opset10::MatMul>(consumer) || port != 1)
+                        return true;
+                }
+                return false;
+            });
+    }
+
+    if (_keepFP16Weights) {
+        // Only FP16 weights of MatMul are kept compressed, the decompression is fused into FullyConnected node
+        auto isFP16WeightsDecompression = [](const ngraph::Node* convert) -> bool {
+            if (!ov::is_type<ov::opset10::Convert>(convert) || convert->get_input_element_type(0) != ov::element::f16)
+                return false;
+            for (const auto& target : convert->get_output_target_inputs(0)) {
+                if (!ov::is_type<ov::opset10::MatMul>(target.get_node()) || target.get_index() != 1)
+                    return false;
+            }
+            return true;
+        };
+        pass_config->set_callback<ov::pass::DisableDecompressionConvertConstantFolding>(
+            [isFP16WeightsDecompression](const_node_ptr &node) -> bool {
+                return !isFP16WeightsDecompression(node.get());
+            });
+        // FP16 constants with such consumers must not be upgraded to FP32 data type
+        pass_config->set_callback<ov::pass::ConvertPrecision>(
+            [isFP16WeightsDecompression](const_node_ptr &node) -> bool {
+                if (!ov::is_type<ov::opset10::Constant>(node) || node->get_output_element_type(0) != ov::element::f16)
+                    return false;
+                const auto& targets = node->get_output_target_inputs(0);
+                return !targets.empty() && std::all_of(targets.begin(), targets.end(), [&](const ov::Input<ov::Node>& target) {
+                    return ov::is_decompression(target.get_node()->shared_from_this()) && isFP16WeightsDecompression(target.get_node());
+                });
+            });
+    } else {
+        // Allow FP16 Converts to be folded and FP16 constants to be upgraded to FP32 data type
+        pass_config->disable<ov::pass::DisableDecompressionConvertConstantFolding>();
+    }
+
     // List of enabled/disabled transformations
 
-    // Allow FP16 Converts to be folded and FP16 constants to be upgraded to FP32 data type
-    pass_config->disable<ov::pass::DisableDecompressionConvertConstantFolding>();
     pass_config->disable<ov::pass::ConvertCompressedOnlyToLegacy>();
     pass_config->disable<ov::pass::EyeDecomposition>();
 
@@ -692,7 +748,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                     const auto& outputs = n->outputs();
                     const bool bad_output_rank = std::any_of(outputs.begin(), outputs.end(),
                                                              [&](const ov::Output<const ov::Node>& out) {return  rank_is_too_large(out.get_tensor());});
-                    return has_only_const_inputs || bad_input_rank || bad_output_rank;
+                    // weights decompression is fused into FullyConnected
+                    const bool is_weights_decompression = isWeightsDecompressionNode(n);
+                    return has_only_const_inputs || bad_input_rank || bad_output_rank || is_weights_decompression;
                 });
         snippetsManager.register_pass<ngraph::snippets::pass::CommonOptimizations>();
         snippetsManager.run_passes(nGraphFunc);
@@ -897,11 +955,14 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !enableDynamicBatch;
+    const auto& fp16WeightsProp = config.find(InferenceEngine::CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS);
+    const bool keepFP16Weights = fp16WeightsProp != config.end() ? fp16WeightsProp->second == PluginConfigParams::YES
+                                                                 : engConfig.keepFP16Weights;
     auto nGraphFunc = clonedNetwork.getFunction();
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, isLegacyAPI());
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, isLegacyAPI(), keepFP16Weights);
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -1003,6 +1064,14 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::keep_fp16_weights) {
+        const bool keepFP16Weights = engConfig.keepFP16Weights;
+        return decltype(ov::intel_cpu::keep_fp16_weights)::value_type(keepFP16Weights);
+    } else if (name == ov::intel_cpu::hw_perf_counters) {
+        const bool hwPerfCounters = engConfig.collectHwPerfCounters;
+        return decltype(ov::intel_cpu::hw_perf_counters)::value_type(hwPerfCounters);
+    } else if (name == ov::intel_cpu::perf_trace_file) {
+        return decltype(ov::intel_cpu::perf_trace_file)::value_type(engConfig.perfTraceFile);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -1085,6 +1154,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_cpu::keep_fp16_weights.name()),
+                                                    RW_property(ov::intel_cpu::hw_perf_counters.name()),
+                                                    RW_property(ov::intel_cpu::perf_trace_file.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -1154,7 +1226,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
 
     auto supported = GetSupportedNodes(model,
     [&](std::shared_ptr<ov::Model>& model) {
-            TransformationUpToCPUSpecificOpSet(model, enableLPT, conf.enforceBF16, enableSnippets, isLegacyAPI());
+            TransformationUpToCPUSpecificOpSet(model, enableLPT, conf.enforceBF16, enableSnippets, isLegacyAPI(), conf.keepFP16Weights);
             ConvertToCPUSpecificOpset(model);
         },
     [&](const std::shared_ptr<ngraph::Node>& op) {
@@ -46,12 +46,15 @@
 #include "gru_sequence_shape_inference.hpp"
 #include "gru_cell_shape_inference.hpp"
 #include "interpolate_shape_inference.hpp"
+#include "irdft_shape_inference.hpp"
 #include "lstm_cell_shape_inference.hpp"
 #include "matmul_shape_inference.hpp"
 #include "one_hot_shape_inference.hpp"
 #include "pad_shape_inference.hpp"
+#include "pooling_shape_inference.hpp"
 #include "proposal_shape_inference.hpp"
 #include "range_shape_inference.hpp"
+#include "rdft_shape_inference.hpp"
 #include "read_value_shape_inference.hpp"
 #include "reduce_shape_inference.hpp"
 #include "region_yolo_shape_inference.hpp"
@@ -299,6 +302,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
 
     void post_validate_and_infer_types(const std::shared_ptr<ov::Node>& local_op) override {
         auto node = dynamic_cast<OP*>(local_op.get());
@@ -335,6 +341,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
     std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
         const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
@@ -362,6 +371,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
     std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
         const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
@@ -389,6 +401,61 @@ protected:
     bool is_grouped;
 };
 
+template <typename OP>
+class entryPooling : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return pads_begin;
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return pads_end;
+    }
+    bool has_pads() const override {
+        return true;
+    }
+    std::vector<StaticShape> infer(
+        const std::vector<StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<OP*>(node.get());
+        std::vector<StaticShape> output_shapes(op->get_output_size());
+        shape_infer(op, pads_begin, pads_end, input_shapes, output_shapes);
+        return output_shapes;
+    }
+
+protected:
+    ov::CoordinateDiff pads_begin, pads_end;
+};
+
+class entryRDFT : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    std::vector<StaticShape> infer(
+        const std::vector<StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<ov::op::v9::RDFT*>(node.get());
+        std::vector<StaticShape> output_shapes(op->get_output_size());
+        ov::op::util::rdft_shape_infer(op, input_shapes, output_shapes, constant_data);
+        return output_shapes;
+    }
+};
+
+class entryIRDFT : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    std::vector<StaticShape> infer(
+        const std::vector<StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<ov::op::v9::IRDFT*>(node.get());
+        std::vector<StaticShape> output_shapes(op->get_output_size());
+        ov::op::util::irdft_shape_infer(op, input_shapes, output_shapes, constant_data);
+        return output_shapes;
+    }
+};
+
 template <typename OP>
 std::shared_ptr<entryIOC<OP>> make_shared_entryIOC(std::shared_ptr<OP> node) {
     return std::make_shared<entryIOC<OP>>(node);
@@ -414,13 +481,15 @@ std::shared_ptr<IShapeInferCommon> make_shape_inference(const std::shared_ptr<ng
         return make_shared_entryIOC(node);
     } else if (ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(op) || ov::is_type<ov::opset1::Convert>(op) ||
             ov::is_type<ov::opset1::LogicalNot>(op) || ov::is_type<ov::opset2::MVN>(op) ||
-            ov::is_type<ov::opset1::Softmax>(op) || ov::is_type<ov::opset8::Softmax>(op)) {
+            ov::is_type<ov::opset1::Softmax>(op) || ov::is_type<ov::opset8::Softmax>(op) ||
+            ov::is_type<ov::opset5::LogSoftmax>(op)) {
         return std::make_shared<entryCopy>(op);
     } else if (ov::is_type<ov::opset6::MVN>(op) || ov::is_type<ov::opset1::LRN>(op) ||
             ov::is_type<ov::opset1::HardSigmoid>(op) || ov::is_type<ov::opset1::Selu>(op) ||
             ov::is_type<ov::opset1::PRelu>(op) || ov::is_type<ov::opset3::CumSum>(op) ||
             ov::is_type<ov::opset1::BatchNormInference>(op) || ov::is_type<ov::opset5::BatchNormInference>(op) ||
-            ov::is_type<ov::opset4::Swish>(op) || ov::is_type<ov::opset1::NormalizeL2>(op)) {
+            ov::is_type<ov::opset4::Swish>(op) || ov::is_type<ov::opset1::NormalizeL2>(op) ||
+            ov::is_type<ov::opset3::ScatterUpdate>(op)) {
         return std::make_shared<entryFirstPassthrough>(op);
     } else if (ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(op) ||
                ov::is_type<ov::op::util::BinaryElementwiseComparison>(op) ||
@@ -561,11 +630,15 @@ std::shared_ptr<IShapeInferCommon> make_shape_inference(const std::shared_ptr<ng
     } else if (auto node = ov::as_type_ptr<ov::opset9::Eye>(op)) {
         return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v8::MaxPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v8::MaxPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v8::MaxPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::MaxPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v1::MaxPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v1::MaxPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::AvgPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v1::AvgPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v1::AvgPool>>(node);
+    } else if (ov::is_type<ov::op::v9::RDFT>(op)) {
+        return std::make_shared<entryRDFT>(op);
+    } else if (ov::is_type<ov::op::v9::IRDFT>(op)) {
+        return std::make_shared<entryIRDFT>(op);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::DeformableConvolution>(op)) {
         return std::make_shared<entryFallbackWithPadding<ov::op::v1::DeformableConvolution>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v8::DeformableConvolution>(op)) {
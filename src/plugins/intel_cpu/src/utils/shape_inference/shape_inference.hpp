@@ -27,6 +27,10 @@ public:
     // infer may generate padding as by-product, these APIs is designed to retrieve them back
     virtual const ov::CoordinateDiff& get_pads_begin() = 0;
     virtual const ov::CoordinateDiff& get_pads_end() = 0;
+    // true if the padding is generated, i.e. the output shapes are not the only result of infer
+    virtual bool has_pads() const {
+        return false;
+    }
 
     virtual const std::vector<int64_t>& get_input_ranks() = 0;
 };
@@ -3,11 +3,18 @@
 //
 
 #include "shape_inference_ngraph.hpp"
+#include "shape_inference_symbolic.hpp"
 
 using namespace ov::intel_cpu;
 
 ShapeInferPtr NgraphShapeInferFactory::makeShapeInfer() const {
-    return std::make_shared<NgraphShapeInfer>(make_shape_inference(m_op), m_port_mask);
+    auto shapeInfer = make_shape_inference(m_op);
+    if (!shapeInfer->has_pads()) {
+        if (auto symbolicShapeInfer = SymbolicShapeInfer::make(m_op)) {
+            return symbolicShapeInfer;
+        }
+    }
+    return std::make_shared<NgraphShapeInfer>(shapeInfer, m_port_mask);
 }
 
 const ov::CoordinateDiff ShapeInferEmptyPads::m_emptyVec = {};
\ No newline at end of file
@@ -0,0 +1,171 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference_symbolic.hpp"
+
+#include <dimension_tracker.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
+
+using namespace ov::intel_cpu;
+
+constexpr size_t SymbolicShapeInfer::CONSTANT_PORT;
+
+namespace {
+size_t findRoot(std::vector<size_t>& parents, size_t label) {
+    while (parents[label] != label) {
+        label = parents[label] = parents[parents[label]];
+    }
+    return label;
+}
+} // namespace
+
+ShapeInferPtr SymbolicShapeInfer::make(const std::shared_ptr<ov::Node>& op) {
+    // the bodies would be copied on clone, such nodes have their own shape inference anyway
+    if (op->get_input_size() == 0 || ov::is_type<ov::op::util::MultiSubGraphOp>(op)) {
+        return nullptr;
+    }
+
+    // label of a dynamic input dimension is its index in this table plus 1 (zero means no label)
+    std::vector<DimExpr> labeledDims;
+    Constraints constraints;
+    // the labels merged by the validation are collected in the table
+    auto equivalence = std::make_shared<ov::TableOfEquivalence>();
+    const ov::DimensionTracker tracker(equivalence);
+    ov::OutputVector inputs;
+    inputs.reserve(op->get_input_size());
+    for (size_t port = 0; port < op->get_input_size(); ++port) {
+        const auto& input = op->input_value(port);
+        if (ov::is_type<ov::op::v0::Constant>(input.get_node())) {
+            constraints.ranks.push_back(CONSTANT_PORT);
+            inputs.push_back(input);
+            continue;
+        }
+        auto shape = input.get_partial_shape();
+        if (shape.rank().is_dynamic()) {
+            return nullptr;
+        }
+        constraints.ranks.push_back(shape.size());
+        for (size_t dim = 0; dim < shape.size(); ++dim) {
+            // labels possibly set by the model transformations are not related to the probe
+            ov::DimensionTracker::reset_tracking_info(shape[dim]);
+            if (shape[dim].is_dynamic()) {
+                labeledDims.push_back({port, dim, 0});
+                tracker.set_up_for_tracking(shape[dim], labeledDims.size());
+            } else {
+                constraints.staticDims.push_back({port, dim, static_cast<Dim>(shape[dim].get_length())});
+            }
+        }
+        inputs.push_back(std::make_shared<ov::op::v0::Parameter>(input.get_element_type(), shape));
+    }
+
+    std::shared_ptr<ov::Node> probe;
+    try {
+        probe = op->clone_with_new_inputs(inputs);
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+
+    std::vector<DimExpr> exprs;
+    std::vector<size_t> outputRanks;
+    std::vector<bool> isUsed(labeledDims.size() + 1, false);
+    for (size_t port = 0; port < probe->get_output_size(); ++port) {
+        const auto& shape = probe->get_output_partial_shape(port);
+        if (shape.rank().is_dynamic()) {
+            return nullptr;
+        }
+        for (const auto& dim : shape) {
+            const auto label = ov::DimensionTracker::get_label(dim);
+            if (dim.is_static()) {
+                exprs.push_back({CONSTANT_PORT, 0, static_cast<Dim>(dim.get_length())});
+            } else if (label != ov::no_label && label <= labeledDims.size()) {
+                exprs.push_back(labeledDims[label - 1]);
+                isUsed[label] = true;
+            } else {
+                return nullptr;
+            }
+        }
+        outputRanks.push_back(shape.size());
+    }
+
+    // Equal labels are checked on inference. A label merged with an unlabeled (static) dimension means a constraint
+    // on the value which isn't known here.
+    std::vector<size_t> parents(labeledDims.size() + 1);
+    for (size_t label = 0; label < parents.size(); ++label) {
+        parents[label] = label;
+    }
+    for (const auto& item : equivalence->get_equivalence_table()) {
+        for (const auto label : item.second) {
+            if (item.first == label) {
+                continue;
+            }
+            if (item.first == ov::no_label || label == ov::no_label ||
+                item.first > labeledDims.size() || label > labeledDims.size()) {
+                return nullptr;
+            }
+            if (item.first < label) {
+                constraints.equalDims.emplace_back(labeledDims[item.first - 1], labeledDims[label - 1]);
+                parents[findRoot(parents, label)] = findRoot(parents, item.first);
+            }
+        }
+    }
+
+    // A dynamic dimension which is neither copied to the outputs nor equal to another one might be constrained in a way
+    // the labels don't reflect (e.g. broadcasting with a static dimension or the number of elements kept by Reshape).
+    std::vector<size_t> classSizes(parents.size(), 0);
+    for (size_t label = 1; label < parents.size(); ++label) {
+        classSizes[findRoot(parents, label)]++;
+    }
+    for (size_t label = 1; label < parents.size(); ++label) {
+        if (!isUsed[label] && classSizes[findRoot(parents, label)] == 1) {
+            return nullptr;
+        }
+    }
+
+    return std::make_shared<SymbolicShapeInfer>(std::move(exprs),
+                                                std::move(outputRanks),
+                                                std::move(constraints),
+                                                std::string(op->get_type_name()) + " " + op->get_friendly_name());
+}
+
+void SymbolicShapeInfer::validate(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes) const {
+    const auto& ranks = m_constraints.ranks;
+    OPENVINO_ASSERT(input_shapes.size() >= ranks.size(),
+                    "Too few input shapes passed to shape inference of ", m_op_name);
+    for (size_t port = 0; port < ranks.size(); ++port) {
+        OPENVINO_ASSERT(ranks[port] == CONSTANT_PORT || input_shapes[port].get().size() == ranks[port],
+                        "Unexpected rank of input ", port, " of ", m_op_name);
+    }
+    for (const auto& dim : m_constraints.staticDims) {
+        OPENVINO_ASSERT(input_shapes[dim.port].get()[dim.dim] == dim.value,
+                        "Dimension ", dim.dim, " of input ", dim.port, " of ", m_op_name, " is expected to be ", dim.value,
+                        ", but it is ", input_shapes[dim.port].get()[dim.dim]);
+    }
+    for (const auto& dims : m_constraints.equalDims) {
+        const auto& lhs = dims.first;
+        const auto& rhs = dims.second;
+        OPENVINO_ASSERT(input_shapes[lhs.port].get()[lhs.dim] == input_shapes[rhs.port].get()[rhs.dim],
+                        "Dimension ", lhs.dim, " of input ", lhs.port, " and dimension ", rhs.dim, " of input ", rhs.port,
+                        " of ", m_op_name, " are expected to be equal");
+    }
+}
+
+std::vector<VectorDims> SymbolicShapeInfer::infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+    validate(input_shapes);
+
+    std::vector<VectorDims> result(m_output_ranks.size());
+    auto expr = m_exprs.data();
+    for (size_t port = 0; port < m_output_ranks.size(); ++port) {
+        auto& dims = result[port];
+        dims.resize(m_output_ranks[port]);
+        for (auto& dim : dims) {
+            dim = expr->port == CONSTANT_PORT ? expr->value : input_shapes[expr->port].get()[expr->dim];
+            ++expr;
+        }
+    }
+    return result;
+}
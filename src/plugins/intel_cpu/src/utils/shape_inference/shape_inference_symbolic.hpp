@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "shape_inference_cpu.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Shape inference implementation which evaluates output dimensions from closed-form expressions derived at compile
+ * time. Each output dimension is either a constant or a copy of an input dimension, so the inference is a single
+ * sweep over a flat array of expressions without any node cloning or shape conversions. The input shapes are
+ * validated against the constraints the operation puts on them: the dimensions static in the model and the equalities
+ * of the dynamic dimensions met during the derivation.
+ *
+ */
+class SymbolicShapeInfer final : public ShapeInferEmptyPads {
+public:
+    /**
+     * @brief Output dimension expression: constant value if port is equal to CONSTANT_PORT,
+     * otherwise dimension dim of the input port
+     */
+    struct DimExpr {
+        size_t port;
+        size_t dim;
+        Dim value;
+    };
+    static constexpr size_t CONSTANT_PORT = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Constraints on the input shapes which must hold for the expressions to be valid
+     */
+    struct Constraints {
+        // rank of every input port, the ports of constant inputs are not checked
+        std::vector<size_t> ranks;
+        // input dimensions which are static in the model
+        std::vector<DimExpr> staticDims;
+        // pairs of input dimensions which must be equal
+        std::vector<std::pair<DimExpr, DimExpr>> equalDims;
+    };
+
+    /**
+     * @brief Derives output dimension expressions of the operation by dimension labels propagation: dynamic input
+     * dimensions are labeled, the operation is validated on labeled inputs and every output dimension must be either
+     * static or carry a label of some input dimension. The equalities of the labels merged during the validation
+     * become the constraints on the input shapes.
+     *
+     * @param op ngraph operation
+     * @return shape inference object or nullptr if some output dimension can't be expressed this way
+     * (e.g. it is computed from several dimensions or depends on the input data) or the operation puts constraints
+     * on the input dimensions which aren't expressed by the labels equalities (e.g. a dynamic dimension is merged
+     * with a static one, or it is used neither by outputs nor by the equalities)
+     */
+    static ShapeInferPtr make(const std::shared_ptr<ov::Node>& op);
+
+    SymbolicShapeInfer(std::vector<DimExpr> exprs, std::vector<size_t> outputRanks, Constraints constraints,
+                       std::string opName) :
+        m_exprs(std::move(exprs)), m_output_ranks(std::move(outputRanks)), m_constraints(std::move(constraints)),
+        m_op_name(std::move(opName)) {}
+
+    std::vector<VectorDims> infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    void validate(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes) const;
+
+    std::vector<DimExpr> m_exprs;
+    std::vector<size_t> m_output_ranks;
+    Constraints m_constraints;
+    std::string m_op_name;
+};
+
+} // namespace intel_cpu
+} // namespace ov
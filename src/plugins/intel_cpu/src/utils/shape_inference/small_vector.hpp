@@ -0,0 +1,360 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Vector-like container which keeps up to N elements inside the object and
+ * allocates heap memory only when the size exceeds N.
+ * Provides the subset of std::vector API used by shape inference, iterators are plain pointers.
+ * @note T must be default constructible: all N inline elements are constructed together with the container,
+ * so the container is intended for small trivial types like dimensions.
+ */
+template <typename T, size_t N>
+class SmallVector {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SmallVector() = default;
+
+    explicit SmallVector(size_type count) {
+        resize(count);
+    }
+
+    SmallVector(size_type count, const T& value) {
+        assign(count, value);
+    }
+
+    template <typename InputIt,
+              typename = typename std::enable_if<std::is_convertible<
+                  typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+    SmallVector(InputIt first, InputIt last) {
+        assign(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+
+    SmallVector(const SmallVector& other) {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept {
+        take(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            take(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    void assign(size_type count, const T& value) {
+        const T copy = value;
+        clear();
+        reserve(count);
+        std::fill_n(m_data, count, copy);
+        m_size = count;
+    }
+
+    template <typename InputIt,
+              typename = typename std::enable_if<std::is_convertible<
+                  typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+
+    reference at(size_type pos) {
+        check_range(pos);
+        return m_data[pos];
+    }
+    const_reference at(size_type pos) const {
+        check_range(pos);
+        return m_data[pos];
+    }
+
+    reference operator[](size_type pos) {
+        return m_data[pos];
+    }
+    const_reference operator[](size_type pos) const {
+        return m_data[pos];
+    }
+
+    reference front() {
+        return m_data[0];
+    }
+    const_reference front() const {
+        return m_data[0];
+    }
+    reference back() {
+        return m_data[m_size - 1];
+    }
+    const_reference back() const {
+        return m_data[m_size - 1];
+    }
+
+    pointer data() noexcept {
+        return m_data;
+    }
+    const_pointer data() const noexcept {
+        return m_data;
+    }
+
+    iterator begin() noexcept {
+        return m_data;
+    }
+    const_iterator begin() const noexcept {
+        return m_data;
+    }
+    const_iterator cbegin() const noexcept {
+        return m_data;
+    }
+    iterator end() noexcept {
+        return m_data + m_size;
+    }
+    const_iterator end() const noexcept {
+        return m_data + m_size;
+    }
+    const_iterator cend() const noexcept {
+        return m_data + m_size;
+    }
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator crbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    bool empty() const noexcept {
+        return m_size == 0;
+    }
+    size_type size() const noexcept {
+        return m_size;
+    }
+    size_type max_size() const noexcept {
+        return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(T);
+    }
+    size_type capacity() const noexcept {
+        return m_capacity;
+    }
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity <= m_capacity) {
+            return;
+        }
+        std::unique_ptr<T[]> heap(new T[new_capacity]);
+        std::move(m_data, m_data + m_size, heap.get());
+        m_heap = std::move(heap);
+        m_data = m_heap.get();
+        m_capacity = new_capacity;
+    }
+
+    void shrink_to_fit() {}
+
+    void clear() noexcept {
+        m_size = 0;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return insert(pos, size_type{1}, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        const auto idx = pos - begin();
+        T tmp = std::move(value);
+        grow_for(1);
+        std::move_backward(m_data + idx, m_data + m_size, m_data + m_size + 1);
+        m_data[idx] = std::move(tmp);
+        ++m_size;
+        return m_data + idx;
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        const auto idx = pos - begin();
+        const T copy = value;
+        grow_for(count);
+        std::move_backward(m_data + idx, m_data + m_size, m_data + m_size + count);
+        std::fill_n(m_data + idx, count, copy);
+        m_size += count;
+        return m_data + idx;
+    }
+
+    template <typename InputIt,
+              typename = typename std::enable_if<std::is_convertible<
+                  typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        // the range is copied first as it may belong to this container
+        const SmallVector values(first, last, range_tag{});
+        const auto idx = pos - begin();
+        const auto count = values.size();
+        grow_for(count);
+        std::move_backward(m_data + idx, m_data + m_size, m_data + m_size + count);
+        std::copy(values.begin(), values.end(), m_data + idx);
+        m_size += count;
+        return m_data + idx;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return insert(pos, T(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto idx = first - begin();
+        const auto count = last - first;
+        std::move(m_data + idx + count, m_data + m_size, m_data + idx);
+        m_size -= count;
+        return m_data + idx;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        T tmp(std::forward<Args>(args)...);
+        grow_for(1);
+        m_data[m_size] = std::move(tmp);
+        return m_data[m_size++];
+    }
+
+    void pop_back() {
+        --m_size;
+    }
+
+    void resize(size_type count) {
+        resize(count, T());
+    }
+
+    void resize(size_type count, const T& value) {
+        if (count > m_size) {
+            const T copy = value;
+            reserve(count);
+            std::fill(m_data + m_size, m_data + count, copy);
+        }
+        m_size = count;
+    }
+
+    void swap(SmallVector& other) {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+private:
+    struct range_tag {};
+
+    template <typename InputIt>
+    SmallVector(InputIt first, InputIt last, range_tag) {
+        for (; first != last; ++first) {
+            grow_for(1);
+            m_data[m_size++] = *first;
+        }
+    }
+
+    void grow_for(size_type count) {
+        if (m_size + count > m_capacity) {
+            reserve(std::max(m_size + count, 2 * m_capacity));
+        }
+    }
+
+    void take(SmallVector& other) noexcept {
+        if (other.m_heap) {
+            m_heap = std::move(other.m_heap);
+            m_data = m_heap.get();
+            m_capacity = other.m_capacity;
+        } else {
+            m_heap.reset();
+            m_data = m_inline;
+            m_capacity = N;
+            std::move(other.m_data, other.m_data + other.m_size, m_inline);
+        }
+        m_size = other.m_size;
+        other.m_data = other.m_inline;
+        other.m_capacity = N;
+        other.m_size = 0;
+    }
+
+    void check_range(size_type pos) const {
+        if (pos >= m_size) {
+            throw std::out_of_range("SmallVector index is out of range");
+        }
+    }
+
+    T m_inline[N];
+    std::unique_ptr<T[]> m_heap;
+    T* m_data = m_inline;
+    size_type m_size = 0;
+    size_type m_capacity = N;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
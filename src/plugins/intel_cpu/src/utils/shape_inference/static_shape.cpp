@@ -7,14 +7,14 @@
 namespace ov {
 namespace intel_cpu {
 
-StaticShape::StaticShape(std::vector<StaticDimension> dimensions)
-        : std::vector<StaticDimension>(std::move(dimensions)) {}
+StaticShape::StaticShape(const std::vector<StaticDimension>& dimensions)
+        : Base(dimensions.begin(), dimensions.end()) {}
 
 StaticShape::StaticShape(const std::vector<StaticDimension::value_type>& dimensions)
-        : std::vector<StaticDimension>(dimensions.begin(), dimensions.end()) {}
+        : Base(dimensions.begin(), dimensions.end()) {}
 
 StaticShape::StaticShape(std::initializer_list<StaticDimension> init)
-        : std::vector<StaticDimension>(init.begin(), init.end()) {}
+        : Base(init.begin(), init.end()) {}
 
 
 ov::Shape StaticShape::get_max_shape() const {
@@ -34,7 +34,7 @@ StaticShape operator+(const StaticShape& s1, const StaticShape& s2) {
         throw std::invalid_argument("rank mismatch");
     }
 
-    std::vector<StaticDimension> result(s1.size());
+    StaticShape result(s1.size());
     for (size_t i = 0; i < s1.size(); ++i)
         result[i] = (s1[i] + s2[i]);
     return result;
@@ -112,14 +112,14 @@ bool StaticShape::broadcast_merge_into(StaticShape& dst,
             auto dst_rank = dst.size();
             auto src_rank = src.size();
             auto new_rank = std::max(dst_rank, src_rank);
-            std::vector<StaticDimension> dims(new_rank);
+            StaticShape dims(new_rank);
             bool success = true;
             for (int64_t i = 0; i < new_rank; i++) {
                 auto dsti = i < (new_rank - dst_rank) ? StaticDimension(1) : dst[i - (new_rank - dst_rank)];
                 auto srci = i < (new_rank - src_rank) ? StaticDimension(1) : src[i - (new_rank - src_rank)];
                 success &= StaticDimension::broadcast_merge(dims[i], dsti, srci);
             }
-            dst = StaticShape(std::move(dims));
+            dst = std::move(dims);
             return success;
         }
         case ngraph::op::AutoBroadcastType::PDPD: {
@@ -8,6 +8,7 @@
 
 #include "ngraph/op/util/attr_types.hpp"
 #include "openvino/core/attribute_adapter.hpp"
+#include "small_vector.hpp"
 #include "static_dimension.hpp"
 #include "openvino/core/rank.hpp"
 #include "openvino/core/shape.hpp"
@@ -21,13 +22,27 @@ namespace op {
 
 namespace intel_cpu {
 
+/// \brief Maximal rank of StaticShape stored without heap allocation.
+constexpr size_t STATIC_SHAPE_INLINE_RANK = 8;
+
 /// \brief Class representing a shape that must be totally static.
-class StaticShape : public std::vector<StaticDimension>  {
+///
+/// Dimensions are stored inside the object up to STATIC_SHAPE_INLINE_RANK, so shape inference
+/// of the ranks used in practice doesn't allocate memory.
+class StaticShape : public SmallVector<StaticDimension, STATIC_SHAPE_INLINE_RANK>  {
 public:
+    using Base = SmallVector<StaticDimension, STATIC_SHAPE_INLINE_RANK>;
+
     StaticShape() = default;
+    explicit StaticShape(size_t rank) : Base(rank) {}
+    StaticShape(size_t rank, const StaticDimension& dimension) : Base(rank, dimension) {}
+    template <typename InputIt,
+              typename = typename std::enable_if<std::is_convertible<
+                  typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+    StaticShape(InputIt first, InputIt last) : Base(first, last) {}
     StaticShape(std::initializer_list<StaticDimension> init);
     StaticShape(const std::vector<StaticDimension::value_type>& dimensions);
-    StaticShape(std::vector<StaticDimension> dimensions);
+    StaticShape(const std::vector<StaticDimension>& dimensions);
 
     StaticShape(const PartialShape &) {
         OPENVINO_UNREACHABLE("[shape infer] Shouldn't convert from PartialShape to StaticShape at runtime.");
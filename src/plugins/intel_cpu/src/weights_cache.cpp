@@ -5,6 +5,7 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
 #include <memory>
 
 namespace ov {
@@ -33,22 +34,74 @@ void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
+namespace {
+// Memory creation may run parallel loops. The calling thread must not execute other tasks of the outer parallel
+// region meanwhile (e.g. primitives creation of other nodes): they may request the same memory and wait for the
+// guard held by this thread forever.
+MemoryPtr createIsolated(const std::function<MemoryPtr(void)>& create) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    MemoryPtr ptr;
+    tbb::this_task_arena::isolate([&] {
+        ptr = create();
+    });
+    return ptr;
+#else
+    return create();
+#endif
+}
+}  // namespace
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MemoryPtr(void)> create,
                             bool valid) {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
-    {
+    std::unique_lock<std::mutex> entryLock;
+    while (true) {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(key);
+        if (found != sharedWeights.end() && (ptr = found->second)) {
+            if ((newPtr = ptr->sharedMemory.lock()))
+                break;
+            if (ptr->pending) {
+                // wait for another thread to create the memory outside of the global lock and look it up again
+                lock.unlock();
+                std::lock_guard<std::mutex> wait(ptr->guard);
+                continue;
+            }
+        }
 
-        if (found == sharedWeights.end()
-            || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
-            newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+        // The placeholder entry is locked until the memory is created, so the global lock isn't held while
+        // creating and the memory with other keys can be created in parallel.
+        ptr = std::make_shared<MemoryInfo>(nullptr, valid);
+        ptr->pending = true;
+        entryLock = std::unique_lock<std::mutex>(ptr->guard);
+        sharedWeights[key] = ptr;
+        lock.unlock();
+
+        try {
+            newPtr = createIsolated(create);
+        } catch (...) {
+            lock.lock();
+            found = sharedWeights.find(key);
+            if (found != sharedWeights.end() && found->second == ptr)
+                sharedWeights.erase(found);
+            ptr->pending = false;
+            throw;
         }
+
+        lock.lock();
+        ptr->sharedMemory = newPtr;
+        ptr->pending = false;
+        break;
+    }
+
+    if (entryLock.owns_lock()) {
+        // the invalid memory stays locked until it is filled by the caller
+        if (ptr->valid.load(std::memory_order_relaxed))
+            entryLock.unlock();
+        return std::make_shared<SharedMemory>(std::move(entryLock), ptr, newPtr);
     }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                                 ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
@@ -58,13 +111,19 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
-    {
+    while (true) {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(key);
+        if (found != sharedWeights.end() && (ptr = found->second) && ptr->pending) {
+            lock.unlock();
+            std::lock_guard<std::mutex> wait(ptr->guard);
+            continue;
+        }
 
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock())))
             IE_THROW() << "Unknown shared memory with key " << key;
+        break;
     }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                                 ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
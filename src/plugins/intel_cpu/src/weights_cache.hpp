@@ -65,6 +65,8 @@ class WeightsSharing {
         std::mutex guard;
         std::weak_ptr<Memory> sharedMemory;
         std::atomic<bool> valid;
+        // the memory is being created by the thread holding the guard, is protected by WeightsSharing::guard
+        bool pending = false;
     };
 
 public:
@@ -4,6 +4,7 @@
 
 #include "behavior/ov_plugin/core_integration.hpp"
 #include <openvino/runtime/properties.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include "ie_system_conf.h"
 #include "openvino/runtime/core.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -249,6 +250,64 @@ TEST(OVClassBasicTest, smoke_SetConfigEnableProfiling) {
     ASSERT_EQ(enableProfiling, value);
 }
 
+TEST(OVClassBasicTest, smoke_SetConfigKeepFP16Weights) {
+    ov::Core ie;
+    bool value = true;
+
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::keep_fp16_weights));
+    ASSERT_FALSE(value);
+
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::intel_cpu::keep_fp16_weights(true)));
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::keep_fp16_weights));
+    ASSERT_TRUE(value);
+
+    std::vector<ov::PropertyName> supportedProperties;
+    OV_ASSERT_NO_THROW(supportedProperties = ie.get_property("CPU", ov::supported_properties));
+    const auto it = std::find(supportedProperties.begin(), supportedProperties.end(), ov::intel_cpu::keep_fp16_weights);
+    ASSERT_NE(it, supportedProperties.end());
+    ASSERT_TRUE(it->is_mutable());
+
+    ASSERT_THROW(ie.set_property("CPU", {{ov::intel_cpu::keep_fp16_weights.name(), "OFF"}}), ov::Exception);
+}
+
+TEST(OVClassBasicTest, smoke_SetConfigHwPerfCounters) {
+    ov::Core ie;
+    bool value = true;
+
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::hw_perf_counters));
+    ASSERT_FALSE(value);
+
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::intel_cpu::hw_perf_counters(true)));
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::hw_perf_counters));
+    ASSERT_TRUE(value);
+
+    std::vector<ov::PropertyName> supportedProperties;
+    OV_ASSERT_NO_THROW(supportedProperties = ie.get_property("CPU", ov::supported_properties));
+    const auto it = std::find(supportedProperties.begin(), supportedProperties.end(), ov::intel_cpu::hw_perf_counters);
+    ASSERT_NE(it, supportedProperties.end());
+    ASSERT_TRUE(it->is_mutable());
+
+    ASSERT_THROW(ie.set_property("CPU", {{ov::intel_cpu::hw_perf_counters.name(), "OFF"}}), ov::Exception);
+}
+
+TEST(OVClassBasicTest, smoke_SetConfigPerfTraceFile) {
+    ov::Core ie;
+    std::string value = "not empty";
+
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::perf_trace_file));
+    ASSERT_TRUE(value.empty());
+
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::intel_cpu::perf_trace_file("cpu_perf_trace.json")));
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::perf_trace_file));
+    ASSERT_EQ("cpu_perf_trace.json", value);
+
+    std::vector<ov::PropertyName> supportedProperties;
+    OV_ASSERT_NO_THROW(supportedProperties = ie.get_property("CPU", ov::supported_properties));
+    const auto it = std::find(supportedProperties.begin(), supportedProperties.end(), ov::intel_cpu::perf_trace_file);
+    ASSERT_NE(it, supportedProperties.end());
+    ASSERT_TRUE(it->is_mutable());
+}
+
 // IE Class Query network
 
 INSTANTIATE_TEST_SUITE_P(
@@ -3,6 +3,7 @@
 //
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_system_conf.h"
 #include "behavior/plugin/configuration_tests.hpp"
 
@@ -54,6 +55,11 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PERF_TRACE_FILE, "cpu_perf_trace.json"}},
             // check that hints doesn't override customer value (now for streams and later for other config opts)
             {{InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT, InferenceEngine::PluginConfigParams::THROUGHPUT},
              {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "3"}},
@@ -147,7 +153,9 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "should be int"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, "OFF"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -248,7 +256,13 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_HW_PERF_COUNTERS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PERF_TRACE_FILE, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PERF_TRACE_FILE, "cpu_perf_trace.json"}}
     };
 
     INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, CorrectConfigCheck,
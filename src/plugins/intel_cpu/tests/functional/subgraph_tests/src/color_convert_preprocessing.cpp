@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <openvino/opsets/opset8.hpp>
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class ColorConvertPreprocessingTest : virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    void BuildGraph(bool singlePlane, bool transposeOnly = false) {
+        const size_t height = 16, width = 24;
+        inPrc = Precision::U8;
+        outPrc = transposeOnly ? Precision::U8 : Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        ngraph::ParameterVector params;
+        std::shared_ptr<ngraph::Node> nv12ToRgb;
+        if (singlePlane) {
+            params.push_back(std::make_shared<ov::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, height * 3 / 2, width, 1}));
+            nv12ToRgb = std::make_shared<ov::opset8::NV12toBGR>(params[0]);
+        } else {
+            params.push_back(std::make_shared<ov::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, height, width, 1}));
+            params.push_back(std::make_shared<ov::opset8::Parameter>(ngraph::element::u8, ngraph::Shape{1, height / 2, width / 2, 2}));
+            nv12ToRgb = std::make_shared<ov::opset8::NV12toBGR>(params[0], params[1]);
+        }
+
+        auto order = ov::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 3, 1, 2});
+        if (transposeOnly) {
+            auto transpose = std::make_shared<ov::opset8::Transpose>(nv12ToRgb, order);
+            ngraph::ResultVector results{std::make_shared<ov::opset8::Result>(transpose)};
+            function = std::make_shared<ngraph::Function>(results, params, "ColorConvertTranspose");
+            return;
+        }
+
+        auto convert = std::make_shared<ov::opset8::Convert>(nv12ToRgb, ngraph::element::f32);
+        auto mean = ov::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, {103.94f, 116.78f, 123.68f});
+        auto subtract = std::make_shared<ov::opset8::Subtract>(convert, mean);
+        auto scale = ov::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{1, 1, 1, 3}, {0.017f, 0.018f, 0.019f});
+        auto multiply = std::make_shared<ov::opset8::Multiply>(subtract, scale);
+        auto transpose = std::make_shared<ov::opset8::Transpose>(multiply, order);
+
+        ngraph::ResultVector results{std::make_shared<ov::opset8::Result>(transpose)};
+        function = std::make_shared<ngraph::Function>(results, params, "ColorConvertPreprocessing");
+    }
+};
+
+namespace {
+
+/* Convert, mean/scale and layout conversion are done by the color conversion node in one pass.
+
+    Parameter[U8]
+          |
+     NV12toBGR[U8]
+          |
+     Convert[FP32]
+          |
+  Subtract/Multiply[FP32]
+          |
+    Transpose[FP32]
+          |
+     Output[FP32]
+*/
+TEST_F(ColorConvertPreprocessingTest, smoke_FuseSinglePlane_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    BuildGraph(true);
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Transpose", 0);
+}
+
+TEST_F(ColorConvertPreprocessingTest, smoke_FuseTwoPlanes_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    BuildGraph(false);
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Transpose", 0);
+}
+
+/* The layout conversion alone is not fused, the jit color conversion and Transpose are faster than the scalar
+   single pass conversion.
+
+    Parameter[U8]
+          |
+     NV12toBGR[U8]
+          |
+    Transpose[U8]
+          |
+     Output[U8]
+*/
+TEST_F(ColorConvertPreprocessingTest, smoke_TransposeOnlyNotFused_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    BuildGraph(true, true);
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Transpose", 1);
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset10.hpp>
+#include <exec_graph_info.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include <random>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* FullyConnected with pruned fp32 weights skips the blocks of 16 output channels x 1 input channel
+   which are all zero, when the share of such blocks reaches the sparse weights decompression rate
+   (but not less than 0.5). Otherwise, or with fused post ops, oneDNN inner product is used.
+
+  Parameter   Constant (f32, pruned)
+        \       /
+         MatMul
+           |
+   [Add per channel | Relu]
+           |
+         Result
+*/
+enum class PruningPattern {
+    InputChannels,   // every input channel but each fourth one is zero for all output channels
+    OutputChannels,  // all the output channels but the first block of 16 are zero
+    RandomBlocks     // blocks of 16 output channels x 1 input channel are zero with probability 0.6
+};
+
+enum class BlockSparsePostOp {
+    None,
+    Bias,
+    Relu
+};
+
+using BlockSparseFCParams = std::tuple<InputShape,         // input shape
+                                       size_t,             // number of output channels
+                                       PruningPattern,
+                                       float,              // sparse weights decompression rate
+                                       BlockSparsePostOp>;
+
+class FullyConnectedBlockSparseTest : public testing::WithParamInterface<BlockSparseFCParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BlockSparseFCParams>& obj) {
+        InputShape inputShape;
+        size_t OC;
+        PruningPattern pattern;
+        float sparseRate;
+        BlockSparsePostOp postOp;
+        std::tie(inputShape, OC, pattern, sparseRate, postOp) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        }
+        result << "OC=" << OC << "_";
+        result << "Pruning=" << (pattern == PruningPattern::InputChannels ? "InputChannels" :
+                                 pattern == PruningPattern::OutputChannels ? "OutputChannels" : "RandomBlocks") << "_";
+        result << "SparseRate=" << sparseRate << "_";
+        result << "PostOp=" << (postOp == BlockSparsePostOp::None ? "None" :
+                                postOp == BlockSparsePostOp::Bias ? "Bias" : "Relu");
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t blockOC = 16;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t OC;
+        PruningPattern pattern;
+        float sparseRate;
+        BlockSparsePostOp postOp;
+        std::tie(inputShape, OC, pattern, sparseRate, postOp) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        configuration.insert(ov::intel_cpu::sparse_weights_decompression_rate(sparseRate));
+        init_input_shapes({inputShape});
+
+        const size_t IC = inputDynamicShapes[0].rbegin()->get_length();
+        const auto weights = generatePrunedWeights(OC, IC, pattern);
+
+        const size_t blocks = (OC + blockOC - 1) / blockOC;
+        size_t nonZeroBlocks = 0;
+        for (size_t b = 0; b < blocks; b++) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                for (size_t oc = b * blockOC; oc < std::min(OC, (b + 1) * blockOC); oc++) {
+                    if (weights[oc * IC + ic] != 0.f) {
+                        nonZeroBlocks++;
+                        break;
+                    }
+                }
+            }
+        }
+        const float blockSparseRate = 1.f - static_cast<float>(nonZeroBlocks) / static_cast<float>(blocks * IC);
+        expectBlockSparse = sparseRate < 1.f && blockSparseRate >= std::max(sparseRate, 0.5f) &&
+                            postOp != BlockSparsePostOp::Relu;
+
+        auto params = builder::makeDynamicParams(ElementType::f32, {inputDynamicShapes[0]});
+        auto weightsNode = opset10::Constant::create(ElementType::f32, Shape{OC, IC}, weights);
+        std::shared_ptr<Node> output = std::make_shared<opset10::MatMul>(params[0], weightsNode, false, true);
+        if (postOp == BlockSparsePostOp::Bias) {
+            auto bias = builder::makeConstant<float>(ElementType::f32, {OC}, {}, true, 1.f, -1.f);
+            output = std::make_shared<opset10::Add>(output, bias);
+        } else if (postOp == BlockSparsePostOp::Relu) {
+            output = std::make_shared<opset10::Relu>(output);
+        }
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset10::Result>(output)},
+                                              params,
+                                              "FullyConnectedBlockSparse");
+    }
+
+    static std::vector<float> generatePrunedWeights(size_t OC, size_t IC, PruningPattern pattern) {
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> dist(0.5f, 1.f);
+        std::bernoulli_distribution zeroBlock(0.6);
+        std::bernoulli_distribution negative(0.5);
+
+        std::vector<float> weights(OC * IC);
+        for (auto& value : weights)
+            value = negative(gen) ? -dist(gen) : dist(gen);
+
+        for (size_t b = 0; b * blockOC < OC; b++) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                const bool isZero = pattern == PruningPattern::InputChannels ? ic % 4 != 0 :
+                                    pattern == PruningPattern::OutputChannels ? b != 0 : zeroBlock(gen);
+                if (!isZero)
+                    continue;
+                for (size_t oc = b * blockOC; oc < std::min(OC, (b + 1) * blockOC); oc++)
+                    weights[oc * IC + ic] = 0.f;
+            }
+        }
+        return weights;
+    }
+
+    bool expectBlockSparse = false;
+};
+
+TEST_P(FullyConnectedBlockSparseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+            continue;
+        const auto primitiveType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+        ASSERT_EQ(expectBlockSparse, primitiveType.rfind("ref_any", 0) == 0) << primitiveType;
+    }
+}
+
+namespace {
+
+// the numbers of output channels are divisible and not divisible by the block of 16 output channels
+const std::vector<size_t> outputChannels = {48, 40};
+
+const std::vector<InputShape> inputShapes = {
+    {{-1, 64}, {{1, 64}, {7, 64}, {32, 64}}},
+    {{-1, -1, 37}, {{1, 1, 37}, {2, 5, 37}}},
+};
+
+const std::vector<PruningPattern> pruningPatterns = {
+    PruningPattern::InputChannels,
+    PruningPattern::OutputChannels,
+    PruningPattern::RandomBlocks,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedBlockSparse, FullyConnectedBlockSparseTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(outputChannels),
+                                            ::testing::ValuesIn(pruningPatterns),
+                                            ::testing::Values(0.f, 0.5f, 0.8f, 1.f),
+                                            ::testing::Values(BlockSparsePostOp::None, BlockSparsePostOp::Bias)),
+                         FullyConnectedBlockSparseTest::getTestCaseName);
+
+// more blocks of output channels than sampled before the weights are scanned
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedBlockSparse_ManyBlocks, FullyConnectedBlockSparseTest,
+                         ::testing::Combine(::testing::Values(InputShape{{-1, 64}, {{1, 64}, {6, 64}}}),
+                                            ::testing::Values(272),
+                                            ::testing::ValuesIn(pruningPatterns),
+                                            ::testing::Values(0.5f, 0.8f),
+                                            ::testing::Values(BlockSparsePostOp::None)),
+                         FullyConnectedBlockSparseTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedBlockSparse_PostOps, FullyConnectedBlockSparseTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(48),
+                                            ::testing::Values(PruningPattern::InputChannels),
+                                            ::testing::Values(0.5f),
+                                            ::testing::Values(BlockSparsePostOp::Relu)),
+                         FullyConnectedBlockSparseTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,203 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <ov_ops/type_relaxed.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+using FuseDequantizationAndNormalizationParams = std::tuple<std::string,  // normalization type: MVN or Softmax
+                                                            int64_t,      // softmax axis
+                                                            float,        // dequantization scale
+                                                            bool,         // per channel dequantization shift
+                                                            bool,         // u8 FakeQuantize on the output
+                                                            bool>;        // the dequantization is expected to be fused
+
+/* The dequantization in front of MVN and Softmax is removed when the node can absorb it, the node reads u8 data then.
+   MVN takes the positive scale into account by epsilon, Softmax applies any scale on the fly, while the shift
+   doesn't change the result if it's the same along the normalized axes. Softmax on u8 data also quantizes its output
+   if it's followed by FakeQuantize.
+   The input shape is dynamic to keep the Eltwise nodes out of snippets.
+
+       Parameter (u8)
+           |
+        Convert
+           |
+   Subtract (per tensor or per channel)
+           |
+        Multiply
+           |
+     MVN or Softmax
+           |
+   [FakeQuantize (u8)]
+           |
+        Result
+*/
+class FuseDequantizationAndNormalizationTest : public testing::WithParamInterface<FuseDequantizationAndNormalizationParams>,
+                                               virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FuseDequantizationAndNormalizationParams>& obj) {
+        std::string normalization;
+        int64_t axis;
+        float scale;
+        bool perChannelShift;
+        bool withFakeQuantize;
+        bool fused;
+        std::tie(normalization, axis, scale, perChannelShift, withFakeQuantize, fused) = obj.param;
+
+        std::ostringstream result;
+        result << normalization << "_";
+        if (normalization == "Softmax")
+            result << "axis=" << axis << "_";
+        result << "scale=" << scale << "_";
+        result << (perChannelShift ? "perChannelShift" : "perTensorShift") << "_";
+        if (withFakeQuantize)
+            result << "FakeQuantize_";
+        result << (fused ? "fused" : "notFused");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        int64_t axis;
+        float scale;
+        bool perChannelShift;
+        bool withFakeQuantize;
+        std::tie(normalization, axis, scale, perChannelShift, withFakeQuantize, fused) = GetParam();
+
+        InputShape inputShape{{-1, 8, -1, -1}, {{1, 8, 16, 16}, {2, 8, 5, 7}}};
+        init_input_shapes({inputShape});
+
+        auto param = std::make_shared<opset8::Parameter>(element::u8, inputDynamicShapes[0]);
+        auto convert = std::make_shared<opset8::Convert>(param, element::f32);
+        auto shift = perChannelShift
+            ? opset8::Constant::create(element::f32, Shape{1, 8, 1, 1}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f})
+            : opset8::Constant::create(element::f32, Shape{}, {4.f});
+        auto subtract = std::make_shared<opset8::Subtract>(convert, shift);
+        auto multiply = std::make_shared<opset8::Multiply>(subtract, opset8::Constant::create(element::f32, Shape{}, {scale}));
+
+        std::shared_ptr<Node> output;
+        if (normalization == "MVN") {
+            std::string epsMode = "inside_sqrt";
+            output = builder::makeMVN6(multiply,
+                                       opset8::Constant::create(element::i64, Shape{2}, {2, 3}),
+                                       true,
+                                       1e-4f,
+                                       epsMode);
+        } else {
+            output = std::make_shared<opset8::Softmax>(multiply, axis);
+        }
+        if (withFakeQuantize) {
+            output = std::make_shared<ov::op::TypeRelaxed<opset8::FakeQuantize>>(
+                opset8::FakeQuantize(output,
+                                     opset8::Constant::create(element::f32, Shape{}, {0.f}),
+                                     opset8::Constant::create(element::f32, Shape{}, {1.f}),
+                                     opset8::Constant::create(element::f32, Shape{}, {0.f}),
+                                     opset8::Constant::create(element::f32, Shape{}, {255.f}),
+                                     256),
+                element::u8);
+            // the probabilities at the middle between two levels may be rounded differently
+            abs_threshold = 1.f;
+        }
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset8::Result>(output)},
+                                              ParameterVector{param},
+                                              "FuseDequantizationAndNormalization");
+        withOutputQuantization = withFakeQuantize;
+    }
+
+    void checkNormalizationPrecisions() {
+        size_t count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (it == rtInfo.end() || it->second.as<std::string>() != normalization)
+                continue;
+            count++;
+            EXPECT_EQ(node->get_input_element_type(0), fused ? element::u8 : element::f32);
+            if (withOutputQuantization)
+                EXPECT_EQ(node->get_output_element_type(0), element::u8);
+        }
+        EXPECT_EQ(count, 1);
+    }
+
+    std::string normalization;
+    bool fused = false;
+    bool withOutputQuantization = false;
+};
+
+TEST_P(FuseDequantizationAndNormalizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    checkNormalizationPrecisions();
+    if (fused) {
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    }
+    if (withOutputQuantization)
+        CheckNumberOfNodesWithType(compiledModel, "FakeQuantize", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseDequantizationAndMVN, FuseDequantizationAndNormalizationTest,
+                         ::testing::Combine(::testing::Values("MVN"),
+                                            ::testing::Values(0),
+                                            ::testing::Values(0.05f),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true)),
+                         FuseDequantizationAndNormalizationTest::getTestCaseName);
+
+// mvn(-x) == -mvn(x), the negative scale is not absorbed
+INSTANTIATE_TEST_SUITE_P(smoke_FuseDequantizationAndMVN_NegativeScale, FuseDequantizationAndNormalizationTest,
+                         ::testing::Combine(::testing::Values("MVN"),
+                                            ::testing::Values(0),
+                                            ::testing::Values(-0.05f),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false)),
+                         FuseDequantizationAndNormalizationTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseDequantizationAndSoftmax, FuseDequantizationAndNormalizationTest,
+                         ::testing::Combine(::testing::Values("Softmax"),
+                                            ::testing::Values(3),
+                                            ::testing::Values(0.05f, -0.05f),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(true)),
+                         FuseDequantizationAndNormalizationTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseDequantizationAndSoftmax_ChannelAxis, FuseDequantizationAndNormalizationTest,
+                         ::testing::Combine(::testing::Values("Softmax"),
+                                            ::testing::Values(1),
+                                            ::testing::Values(0.05f),
+                                            ::testing::Values(false),
+                                            ::testing::Bool(),
+                                            ::testing::Values(true)),
+                         FuseDequantizationAndNormalizationTest::getTestCaseName);
+
+// the per channel shift changes the result of softmax along the channels
+INSTANTIATE_TEST_SUITE_P(smoke_FuseDequantizationAndSoftmax_ChannelAxisPerChannelShift,
+                         FuseDequantizationAndNormalizationTest,
+                         ::testing::Combine(::testing::Values("Softmax"),
+                                            ::testing::Values(1),
+                                            ::testing::Values(0.05f),
+                                            ::testing::Values(true),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false)),
+                         FuseDequantizationAndNormalizationTest::getTestCaseName);
+
+}  // namespace
+
+} // namespace SubgraphTestsDefinitions
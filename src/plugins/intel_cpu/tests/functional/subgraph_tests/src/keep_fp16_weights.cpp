@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset10.hpp>
+#include <exec_graph_info.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include <transformations/rt_info/decompression.hpp>
+#include <limits>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* FP16 compressed weights of MatMul are kept in FP16 and converted inside FullyConnected node
+   when ov::intel_cpu::keep_fp16_weights is enabled and the number of source rows is small,
+   otherwise the decompression Convert is folded, so FP16 weights are not kept together with FP32 ones.
+
+       Constant (f16)
+           |
+   Convert (decompression)
+           |
+  Parameter  /
+        \   /
+       MatMul
+         |
+       Result
+*/
+using KeepFP16WeightsParams = std::tuple<InputShape,  // input shape
+                                         size_t,      // number of output channels
+                                         bool>;       // keep fp16 weights
+
+class KeepFP16WeightsTest : public testing::WithParamInterface<KeepFP16WeightsParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<KeepFP16WeightsParams>& obj) {
+        InputShape inputShape;
+        size_t OC;
+        bool keepFP16Weights;
+        std::tie(inputShape, OC, keepFP16Weights) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        }
+        result << "OC=" << OC << "_";
+        result << "KeepFP16Weights=" << keepFP16Weights;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t OC;
+        std::tie(inputShape, OC, keepFP16Weights) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        configuration.insert(ov::intel_cpu::keep_fp16_weights(keepFP16Weights));
+        init_input_shapes({inputShape});
+
+        const size_t IC = inputDynamicShapes[0].rbegin()->get_length();
+        auto params = builder::makeDynamicParams(ElementType::f32, {inputDynamicShapes[0]});
+        auto weights = builder::makeConstant<float>(ElementType::f16, {OC, IC}, {}, true, 1.f, -1.f);
+        auto convert = std::make_shared<opset10::Convert>(weights, ElementType::f32);
+        ov::mark_as_decompression(convert);
+        auto matMul = std::make_shared<opset10::MatMul>(params[0], convert, false, true);
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset10::Result>(matMul)},
+                                              params,
+                                              "KeepFP16Weights");
+
+        // FP16 weights are multiplied by FullyConnected own kernel only for up to 16 rows
+        size_t maxRows = 1;
+        for (size_t i = 0; i + 1 < inputDynamicShapes[0].size() && maxRows <= 16; i++) {
+            const auto maxDim = inputDynamicShapes[0][i].get_max_length();
+            maxRows = maxDim < 0 ? std::numeric_limits<size_t>::max() : maxRows * maxDim;
+        }
+        expectFP16Weights = keepFP16Weights && maxRows <= 16;
+    }
+
+    bool keepFP16Weights = false;
+    bool expectFP16Weights = false;
+};
+
+TEST_P(KeepFP16WeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+
+    ASSERT_EQ(keepFP16Weights, compiledModel.get_property(ov::intel_cpu::keep_fp16_weights));
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        if (node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+            continue;
+        const auto& weightsRtInfo = node->get_input_node_shared_ptr(1)->get_rt_info();
+        ASSERT_EQ(expectFP16Weights ? "FP16" : "FP32",
+                  weightsRtInfo.at(ExecGraphInfoSerialization::OUTPUT_PRECISIONS).as<std::string>());
+    }
+}
+
+namespace {
+
+// 67 input channels aren't a multiple of the vector length, the rows are processed by blocks of 4 with the tail
+const std::vector<InputShape> inputShapes = {
+    {{{1, 4}, 64}, {{1, 64}, {4, 64}}},
+    {{1, {1, 16}, 67}, {{1, 16, 67}, {1, 7, 67}, {1, 1, 67}}},
+    {{-1, -1, 64}, {{2, 32, 64}, {1, 1, 64}, {3, 17, 64}}},
+    {{32, 64}, {{32, 64}}},
+};
+
+// 37 output channels give the odd output channel of the last block
+INSTANTIATE_TEST_SUITE_P(smoke_KeepFP16Weights, KeepFP16WeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(32, 37),
+                                            ::testing::Values(true, false)),
+                         KeepFP16WeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* Interpolate follows the blocked layout of Convolution, so every Gather which supports only the planar layout
+   would need its own Reorder. The layout planning switches Interpolate to the planar layout, which leaves a single
+   Reorder of the smaller tensor in front of it.
+
+       Parameter
+           |
+      Convolution
+           |
+      Interpolate
+      /    |    \
+  Gather Gather Gather
+     |     |     |
+  Result Result Result
+*/
+class LayoutPlanningTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        auto type = element::f32;
+        auto param = std::make_shared<opset8::Parameter>(type, Shape{1, 16, 8, 8});
+        auto weights = builder::makeConstant(type, Shape{16, 16, 1, 1}, std::vector<float>{}, true);
+        auto conv = std::make_shared<opset8::Convolution>(param, weights, Strides{1, 1}, CoordinateDiff{0, 0}, CoordinateDiff{0, 0}, Strides{1, 1});
+
+        opset8::Interpolate::InterpolateAttrs attrs;
+        attrs.mode = opset8::Interpolate::InterpolateMode::NEAREST;
+        attrs.shape_calculation_mode = opset8::Interpolate::ShapeCalcMode::SCALES;
+        attrs.pads_begin = {0, 0, 0, 0};
+        attrs.pads_end = {0, 0, 0, 0};
+        auto interpolate = std::make_shared<opset8::Interpolate>(conv,
+                                                                 opset8::Constant::create(element::i64, Shape{2}, {16, 16}),
+                                                                 opset8::Constant::create(type, Shape{2}, {2.f, 2.f}),
+                                                                 opset8::Constant::create(element::i64, Shape{2}, {2, 3}),
+                                                                 attrs);
+        ResultVector results;
+        for (int64_t i = 0; i < 3; i++) {
+            auto gather = std::make_shared<opset8::Gather>(interpolate,
+                                                           opset8::Constant::create(element::i32, Shape{1}, {i}),
+                                                           opset8::Constant::create(element::i32, Shape{1}, {1}));
+            results.push_back(std::make_shared<opset8::Result>(gather));
+        }
+        function = std::make_shared<Function>(results, ParameterVector{param}, "LayoutPlanning");
+    }
+
+    void TearDown() override {
+        auto execFunction = executableNetwork.GetExecGraphInfo().getFunction();
+        int interpolateNodesFound = 0;
+        for (const auto& node : execFunction->get_ordered_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto layerType = rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>();
+            if (layerType == "Interpolate") {
+                interpolateNodesFound++;
+                ASSERT_EQ("abcd", rtInfo.at(ExecGraphInfoSerialization::OUTPUT_LAYOUTS).as<std::string>());
+                ASSERT_NE(rtInfo.find("reorderBytesSaved"), rtInfo.end());
+                ASSERT_GT(std::stoul(rtInfo.at("reorderBytesSaved").as<std::string>()), 0);
+            }
+        }
+        ASSERT_EQ(interpolateNodesFound, 1);
+    }
+};
+
+TEST_F(LayoutPlanningTest, smoke_ReorderBeforeBranching_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // planar jit implementation of Interpolate is available starting from avx2
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    Run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,213 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset10.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The weights decompression subgraph is fused into FullyConnected node when the number of source rows
+   is small, otherwise it is constant folded, so only the decompressed weights are kept, and FullyConnected
+   is executed by oneDNN. The post ops are never fused on the decompression path, so they must stay separate
+   nodes there, while per channel Add is converted into the bias of FullyConnected on both paths.
+
+       Constant (u8/i8)                        Constant (u8/i8)
+           |                                       |
+        Convert                                 Convert
+           |                                       |
+   [Subtract (per channel)]              [Subtract (per group)]
+           |                                       |
+   Multiply (per channel)                 Multiply (per group)
+           |                                       |
+           |                                    Reshape
+           |                                       |
+    Parameter    /                       Parameter    /
+         \      /                             \      /
+          MatMul                               MatMul
+            |                                    |
+       [Post op]                            [Post op]
+            |                                    |
+          Result                               Result
+*/
+enum class DecompressionPostOp {
+    None,
+    Relu,
+    AddPerChannel,
+    MultiplyPerChannel
+};
+
+using MatMulWeightsDecompressionParams = std::tuple<InputShape,           // input shape
+                                                    size_t,               // number of output channels
+                                                    size_t,               // number of decompression groups
+                                                    ElementType,          // weights precision
+                                                    bool,                 // with zero point
+                                                    DecompressionPostOp>;
+
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MatMulWeightsDecompressionParams>& obj) {
+        InputShape inputShape;
+        size_t OC, groups;
+        ElementType weightsPrecision;
+        bool withZeroPoint;
+        DecompressionPostOp postOp;
+        std::tie(inputShape, OC, groups, weightsPrecision, withZeroPoint, postOp) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        }
+        result << "OC=" << OC << "_";
+        result << "G=" << groups << "_";
+        result << "WPRC=" << weightsPrecision << "_";
+        result << "ZP=" << withZeroPoint << "_";
+        result << "PostOp=" << (postOp == DecompressionPostOp::None ? "None" :
+                                postOp == DecompressionPostOp::Relu ? "Relu" :
+                                postOp == DecompressionPostOp::AddPerChannel ? "AddPerChannel" : "MultiplyPerChannel");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+        InputShape inputShape;
+        size_t OC, groups;
+        ElementType weightsPrecision;
+        bool withZeroPoint;
+        std::tie(inputShape, OC, groups, weightsPrecision, withZeroPoint, postOp) = this->GetParam();
+        init_input_shapes({inputShape});
+
+        const size_t IC = inputDynamicShapes[0].rbegin()->get_length();
+        const std::vector<size_t> weightsShape = groups == 1 ? std::vector<size_t>{OC, IC}
+                                                             : std::vector<size_t>{OC, groups, IC / groups};
+        const std::vector<size_t> decompressionShape = groups == 1 ? std::vector<size_t>{OC, 1}
+                                                                   : std::vector<size_t>{OC, groups, 1};
+        const bool isSigned = weightsPrecision == ElementType::i8;
+
+        auto params = builder::makeDynamicParams(ElementType::f32, {inputDynamicShapes[0]});
+        auto weights = isSigned ? builder::makeConstant<int8_t>(weightsPrecision, weightsShape, {}, true, 127, -128)
+                                : builder::makeConstant<uint8_t>(weightsPrecision, weightsShape, {}, true, 255, 0);
+        std::shared_ptr<Node> decompression = std::make_shared<opset10::Convert>(weights, ElementType::f32);
+        if (withZeroPoint) {
+            auto zeroPoint = isSigned ? builder::makeConstant<float>(ElementType::f32, decompressionShape, {}, true, 4.f, -4.f)
+                                      : builder::makeConstant<float>(ElementType::f32, decompressionShape, {}, true, 136.f, 120.f);
+            decompression = std::make_shared<opset10::Subtract>(decompression, zeroPoint);
+        }
+        auto scale = builder::makeConstant<float>(ElementType::f32, decompressionShape, {}, true, 0.05f, 0.005f);
+        decompression = std::make_shared<opset10::Multiply>(decompression, scale);
+        if (groups != 1) {
+            auto targetShape = opset10::Constant::create(ElementType::i64, Shape{2}, {OC, IC});
+            decompression = std::make_shared<opset10::Reshape>(decompression, targetShape, false);
+        }
+
+        std::shared_ptr<Node> output = std::make_shared<opset10::MatMul>(params[0], decompression, false, true);
+        if (postOp == DecompressionPostOp::Relu) {
+            output = std::make_shared<opset10::Relu>(output);
+        } else if (postOp == DecompressionPostOp::AddPerChannel) {
+            auto bias = builder::makeConstant<float>(ElementType::f32, {OC}, {}, true, 1.f, -1.f);
+            output = std::make_shared<opset10::Add>(output, bias);
+        } else if (postOp == DecompressionPostOp::MultiplyPerChannel) {
+            auto scale = builder::makeConstant<float>(ElementType::f32, {OC}, {}, true, 2.f, 0.5f);
+            output = std::make_shared<opset10::Multiply>(output, scale);
+        }
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset10::Result>(output)},
+                                              params,
+                                              "MatMulWeightsDecompression");
+    }
+
+    void checkResults(bool withDecompression) {
+        CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto primitiveType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(withDecompression, primitiveType.rfind("ref_any", 0) == 0) << primitiveType;
+        }
+
+        // the decompression is either fused or folded, the compressed weights are not kept together with
+        // the decompressed ones
+        CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+        const bool isSeparatePostOp = postOp == DecompressionPostOp::Relu || postOp == DecompressionPostOp::MultiplyPerChannel;
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", withDecompression && isSeparatePostOp ? 1 : 0);
+    }
+
+    DecompressionPostOp postOp = DecompressionPostOp::None;
+};
+
+class MatMulWeightsDecompressionFewRows : public MatMulWeightsDecompression {};
+class MatMulWeightsDecompressionManyRows : public MatMulWeightsDecompression {};
+
+TEST_P(MatMulWeightsDecompressionFewRows, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    checkResults(true);
+}
+
+TEST_P(MatMulWeightsDecompressionManyRows, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    checkResults(false);
+}
+
+namespace {
+
+// the bounded dimensions keep the number of rows small enough for the decompression kernel,
+// the kernel processes the rows by blocks of 4 with the tail
+const std::vector<InputShape> fewRowsShapes = {
+    {{{1, 4}, 64}, {{1, 64}, {4, 64}, {3, 64}}},
+    {{1, {1, 8}, 64}, {{1, 1, 64}, {1, 8, 64}, {1, 5, 64}}},
+    {{{1, 16}, 64}, {{16, 64}, {7, 64}}},
+};
+
+const std::vector<InputShape> manyRowsShapes = {
+    {{-1, -1, 64}, {{2, 32, 64}, {1, 1, 64}, {3, 17, 64}}},
+    {{32, 64}, {{32, 64}}},
+};
+
+const std::vector<DecompressionPostOp> postOps = {
+    DecompressionPostOp::None,
+    DecompressionPostOp::Relu,
+    DecompressionPostOp::AddPerChannel,
+    DecompressionPostOp::MultiplyPerChannel,
+};
+
+// 36 output channels are not divisible by the block of output channels of the decompression kernel
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression, MatMulWeightsDecompressionFewRows,
+                         ::testing::Combine(::testing::ValuesIn(fewRowsShapes),
+                                            ::testing::Values(32, 36),
+                                            ::testing::Values(1, 4),
+                                            ::testing::Values(ElementType::u8, ElementType::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::ValuesIn(postOps)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression, MatMulWeightsDecompressionManyRows,
+                         ::testing::Combine(::testing::ValuesIn(manyRowsShapes),
+                                            ::testing::Values(36),
+                                            ::testing::Values(1, 4),
+                                            ::testing::Values(ElementType::u8, ElementType::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::ValuesIn(postOps)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset10.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* With profiling enabled the executions of the nodes are written to the Chrome trace JSON file when the compiled
+   model is destroyed. The hardware counters are reported in the runtime model and in the trace if perf_event
+   is available on the system.
+
+  Parameter  Constant
+        \     /
+        MatMul
+          |
+         Relu
+          |
+        Result
+*/
+using PerfTraceParams = bool;  // collect hardware counters
+
+class PerfTraceTest : public testing::WithParamInterface<PerfTraceParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PerfTraceParams>& obj) {
+        std::ostringstream result;
+        result << "HwPerfCounters=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        hwPerfCounters = GetParam();
+        traceFile = std::string("cpu_perf_trace_") + (hwPerfCounters ? "hw" : "time") + ".json";
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        configuration.insert(ov::enable_profiling(true));
+        configuration.insert(ov::intel_cpu::hw_perf_counters(hwPerfCounters));
+        configuration.insert(ov::intel_cpu::perf_trace_file(traceFile));
+        init_input_shapes(static_shapes_to_test_representation({{4, 64}}));
+
+        auto params = builder::makeDynamicParams(ElementType::f32, inputDynamicShapes);
+        auto weights = builder::makeConstant<float>(ElementType::f32, {32, 64}, {}, true, 1.f, -1.f);
+        auto matMul = std::make_shared<opset10::MatMul>(params[0], weights, false, true);
+        matMul->set_friendly_name("TracedMatMul");
+        auto relu = std::make_shared<opset10::Relu>(matMul);
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset10::Result>(relu)},
+                                              params,
+                                              "PerfTrace");
+    }
+
+    void TearDown() override {
+        std::remove(traceFile.c_str());
+    }
+
+    bool hwPerfCounters = false;
+    std::string traceFile;
+};
+
+TEST_P(PerfTraceTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::remove(traceFile.c_str());
+    run();
+
+    bool hwCountersReported = false;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const bool hasCounters = rtInfo.count("cycles") && rtInfo.count("instructions") && rtInfo.count("llc_misses");
+        if (!hwPerfCounters)
+            ASSERT_FALSE(hasCounters) << node->get_friendly_name();
+        hwCountersReported |= hasCounters;
+    }
+
+    // the trace is written when the last graph using it is destroyed
+    inferRequest = {};
+    compiledModel = {};
+
+    std::ifstream file(traceFile);
+    ASSERT_TRUE(file.is_open()) << traceFile;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const auto trace = buffer.str();
+
+    ASSERT_EQ(0u, trace.find("{\"traceEvents\":["));
+    ASSERT_EQ(trace.size() - 3, trace.rfind("]}\n"));
+    // a track per stream, complete events of the nodes and of the whole inferences
+    ASSERT_NE(std::string::npos, trace.find("\"ph\":\"M\""));
+    ASSERT_NE(std::string::npos, trace.find("{\"name\":\"TracedMatMul\",\"cat\":\"FullyConnected\",\"ph\":\"X\""));
+    ASSERT_NE(std::string::npos, trace.find("{\"name\":\"Infer\",\"cat\":\"Infer\",\"ph\":\"X\""));
+    for (const auto key : {"\"ts\":", "\"dur\":", "\"tid\":"})
+        ASSERT_NE(std::string::npos, trace.find(key)) << key;
+
+    if (!hwPerfCounters) {
+        ASSERT_EQ(std::string::npos, trace.find("\"args\":{\"cycles\":"));
+        return;
+    }
+    if (!hwCountersReported)
+        GTEST_SKIP() << "Hardware performance counters are not available (perf_event)";
+    ASSERT_NE(std::string::npos, trace.find("\"args\":{\"cycles\":"));
+    ASSERT_NE(std::string::npos, trace.find("\"instructions\":"));
+    ASSERT_NE(std::string::npos, trace.find("\"llc_misses\":"));
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_PerfTrace, PerfTraceTest,
+                         ::testing::Values(false, true),
+                         PerfTraceTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset10.hpp>
+#include <thread>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The weights of several Convolution and FullyConnected nodes are the same constants, so they are shared
+   via the weights cache, while the primitives of the nodes are created in parallel. The same model is also
+   compiled by several threads at once, which share the weights cache of the plugin.
+
+   Parameter  Constant (conv)       Parameter  Constant (fc)
+         \    /    |                      \    /    |
+      Convolution  |                      MatMul    |
+             \     |                          \     |
+           Convolution                         MatMul
+                |                                |
+              Result                           Result
+*/
+using SharedWeightsParams = size_t;  // number of threads compiling the model in parallel
+
+class SharedWeightsTest : public testing::WithParamInterface<SharedWeightsParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SharedWeightsParams>& obj) {
+        std::ostringstream result;
+        result << "Threads=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+        const size_t channels = 16;
+        const size_t features = 64;
+        init_input_shapes(static_shapes_to_test_representation({{1, channels, 8, 8}, {4, features}}));
+        auto params = builder::makeDynamicParams(ElementType::f32, inputDynamicShapes);
+
+        auto convWeights = builder::makeConstant<float>(ElementType::f32, {channels, channels, 3, 3}, {}, true, 0.1f, -0.1f);
+        std::shared_ptr<Node> conv = params[0];
+        for (size_t i = 0; i < 2; i++) {
+            conv = std::make_shared<opset10::Convolution>(conv, convWeights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                          CoordinateDiff{1, 1}, Strides{1, 1});
+        }
+
+        auto fcWeights = builder::makeConstant<float>(ElementType::f32, {features, features}, {}, true, 0.1f, -0.1f);
+        std::shared_ptr<Node> fc = params[1];
+        for (size_t i = 0; i < 2; i++) {
+            fc = std::make_shared<opset10::MatMul>(fc, fcWeights, false, true);
+        }
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset10::Result>(conv),
+                                                           std::make_shared<opset10::Result>(fc)},
+                                              params,
+                                              "SharedWeights");
+    }
+};
+
+TEST_P(SharedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Convolution", 2);
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 2);
+
+    const auto expected = calculate_refs();
+    std::vector<std::vector<ov::Tensor>> actual(GetParam());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < actual.size(); i++) {
+        threads.emplace_back([&, i] {
+            auto model = core->compile_model(function, targetDevice, configuration);
+            auto request = model.create_infer_request();
+            const auto& parameters = function->get_parameters();
+            for (size_t j = 0; j < parameters.size(); j++)
+                request.set_input_tensor(j, inputs.at(parameters[j]));
+            request.infer();
+            for (size_t j = 0; j < function->get_output_size(); j++)
+                actual[i].push_back(request.get_output_tensor(j));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& outputs : actual)
+        compare(expected, outputs);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_SharedWeights, SharedWeightsTest,
+                         ::testing::Values(1, 4),
+                         SharedWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -15,6 +15,7 @@
 #include <ngraph_transformations/convert_matmul_to_fc.hpp>
 #include <ngraph_transformations/fc_bias_fusion.hpp>
 #include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -510,3 +511,59 @@ TEST(TransformationTests, ConvertMatMulToFCTest_second_input_rank_adj_3) {
     auto res = compare_functions(f, f_ref, true);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+namespace {
+std::shared_ptr<ngraph::Node> makeWeightsDecompression() {
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 4, 3 }, { 2 });
+    auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+    ov::disable_constant_folding(convert);
+    auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 1 });
+    auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1 }, { 0.5f });
+    return std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+}
+}  // namespace
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_few_rows) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ {1, 16}, 3 });
+    auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, makeWeightsDecompression(), false, true);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<ConvertMatMulToFC>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    const auto fc = f->get_results()[0]->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(ov::is_type<FullyConnectedNode>(fc));
+    // the decompression is kept to be fused into FullyConnected
+    ASSERT_TRUE(ov::is_type<ngraph::opset1::Multiply>(fc->get_input_node_shared_ptr(1)));
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_many_rows) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 3 });
+    auto input2 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ 17, 3 });
+    auto decompression = makeWeightsDecompression();
+    auto matmul1 = std::make_shared<ngraph::opset1::MatMul>(input1, decompression, false, true);
+    auto matmul2 = std::make_shared<ngraph::opset1::MatMul>(input2, decompression, false, true);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul1, matmul2 }, ngraph::ParameterVector{ input1, input2 });
+
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<ConvertMatMulToFC>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    // the decompression is folded once for both FullyConnected nodes
+    const auto fc1 = f->get_results()[0]->get_input_node_shared_ptr(0);
+    const auto fc2 = f->get_results()[1]->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(ov::is_type<FullyConnectedNode>(fc1));
+    ASSERT_TRUE(ov::is_type<FullyConnectedNode>(fc2));
+    const auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc1->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, weights);
+    ASSERT_EQ(weights, fc2->get_input_node_shared_ptr(1));
+    ASSERT_EQ(ngraph::element::f32, weights->get_element_type());
+    for (const auto value : weights->cast_vector<float>())
+        ASSERT_EQ(0.5f, value);
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/avg_pool.hpp>
+#include <openvino/op/max_pool.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, MaxPoolV1ExplicitPadsCeilTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto pool = std::make_shared<op::v1::MaxPool>(data,
+                                                  Strides{2, 2},
+                                                  Shape{0, 0},
+                                                  Shape{1, 1},
+                                                  Shape{3, 3},
+                                                  op::RoundingType::CEIL,
+                                                  op::PadType::EXPLICIT);
+
+    auto shape_infer = make_shape_inference(pool);
+    auto output_shapes = shape_infer->infer({StaticShape{1, 3, 10, 9}}, {});
+
+    ASSERT_EQ(output_shapes.size(), 1);
+    ASSERT_EQ(output_shapes[0], StaticShape({1, 3, 5, 5}));
+    ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({0, 0}));
+    ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({1, 1}));
+}
+
+TEST(StaticShapeInferenceTest, MaxPoolV8SameUpperDilationsTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(5));
+    auto pool = std::make_shared<op::v8::MaxPool>(data,
+                                                  Strides{1, 2, 2},
+                                                  Strides{1, 2, 1},
+                                                  Shape{0, 0, 0},
+                                                  Shape{0, 0, 0},
+                                                  Shape{2, 3, 2},
+                                                  op::RoundingType::FLOOR,
+                                                  op::PadType::SAME_UPPER);
+
+    auto shape_infer = make_shape_inference(pool);
+    auto output_shapes = shape_infer->infer({StaticShape{2, 4, 5, 9, 7}}, {});
+
+    ASSERT_EQ(output_shapes.size(), 2);
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 4, 5, 5, 4}));
+    ASSERT_EQ(output_shapes[1], StaticShape({2, 4, 5, 5, 4}));
+    ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({0, 2, 0}));
+    ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({1, 2, 1}));
+}
+
+TEST(StaticShapeInferenceTest, AvgPoolSameLowerTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto pool = std::make_shared<op::v1::AvgPool>(data,
+                                                  Strides{2},
+                                                  Shape{0},
+                                                  Shape{0},
+                                                  Shape{4},
+                                                  true,
+                                                  op::RoundingType::FLOOR,
+                                                  op::PadType::SAME_LOWER);
+
+    auto shape_infer = make_shape_inference(pool);
+    auto output_shapes = shape_infer->infer({StaticShape{1, 8, 7}}, {});
+
+    ASSERT_EQ(output_shapes[0], StaticShape({1, 8, 4}));
+    ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({2}));
+    ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({1}));
+}
+
+TEST(StaticShapeInferenceTest, MaxPoolWindowLargerThanDataTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto pool = std::make_shared<op::v1::MaxPool>(data,
+                                                  Strides{1, 1},
+                                                  Shape{0, 0},
+                                                  Shape{0, 0},
+                                                  Shape{5, 5},
+                                                  op::RoundingType::FLOOR,
+                                                  op::PadType::EXPLICIT);
+
+    auto shape_infer = make_shape_inference(pool);
+    ASSERT_THROW(shape_infer->infer({StaticShape{1, 3, 4, 8}}, {}), NodeValidationFailure);
+}
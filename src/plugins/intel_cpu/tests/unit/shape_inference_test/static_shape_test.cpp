@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeTest, InlineStorage) {
+    StaticShape shape{1, 2, 3, 4, 5, 6, 7, 8};
+    ASSERT_EQ(shape.capacity(), STATIC_SHAPE_INLINE_RANK);
+    const auto data = shape.data();
+
+    StaticShape copy = shape;
+    ASSERT_EQ(copy, shape);
+    ASSERT_NE(copy.data(), data);
+
+    StaticShape moved = std::move(copy);
+    ASSERT_EQ(moved, shape);
+    ASSERT_TRUE(copy.empty());
+}
+
+TEST(StaticShapeTest, HeapStorageBeyondInlineRank) {
+    StaticShape shape{1, 2, 3, 4, 5, 6, 7, 8};
+    shape.push_back(9);
+    shape.insert(shape.begin(), 0);
+    ASSERT_EQ(shape, StaticShape({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    ASSERT_GE(shape.capacity(), shape.size());
+
+    const auto data = shape.data();
+    StaticShape moved = std::move(shape);
+    ASSERT_EQ(moved.data(), data);
+    ASSERT_EQ(moved.to_shape(), ov::Shape({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    moved.erase(moved.begin() + 1, moved.end() - 1);
+    ASSERT_EQ(moved, StaticShape({0, 9}));
+}
+
+TEST(StaticShapeTest, InsertOwnRange) {
+    StaticShape shape{1, 2, 3};
+    shape.insert(shape.begin() + 1, shape.begin(), shape.end());
+    ASSERT_EQ(shape, StaticShape({1, 1, 2, 3, 2, 3}));
+
+    shape.resize(8, 5);
+    ASSERT_EQ(shape, StaticShape({1, 1, 2, 3, 2, 3, 5, 5}));
+    shape.resize(2);
+    ASSERT_EQ(shape, StaticShape({1, 1}));
+}
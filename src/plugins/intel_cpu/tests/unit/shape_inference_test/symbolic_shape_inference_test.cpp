@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/add.hpp>
+#include <openvino/op/concat.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/matmul.hpp>
+#include <openvino/op/max_pool.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/reshape.hpp>
+#include <openvino/op/transpose.hpp>
+#include <utils/shape_inference/shape_inference_cpu.hpp>
+#include <utils/shape_inference/shape_inference_symbolic.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(SymbolicShapeInferenceTest, MatMulWithConstantWeights) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 64});
+    auto weights = op::v0::Constant::create(element::f32, Shape{32, 64}, {0.f});
+    auto matmul = std::make_shared<op::v0::MatMul>(data, weights, false, true);
+
+    auto shape_infer = NgraphShapeInferFactory(matmul, EMPTY_PORT_MASK).makeShapeInfer();
+    ASSERT_NE(std::dynamic_pointer_cast<SymbolicShapeInfer>(shape_infer), nullptr);
+
+    const VectorDims data_dims{2, 7, 64};
+    const VectorDims weights_dims{32, 64};
+    auto output_shapes = shape_infer->infer({std::cref(data_dims), std::cref(weights_dims)}, {});
+    ASSERT_EQ(output_shapes.size(), 1);
+    ASSERT_EQ(output_shapes[0], VectorDims({2, 7, 32}));
+
+    // the inner dimension is static in the model
+    const VectorDims wrong_data_dims{2, 7, 63};
+    ASSERT_THROW(shape_infer->infer({std::cref(wrong_data_dims), std::cref(weights_dims)}, {}), ov::Exception);
+    const VectorDims wrong_rank_dims{2, 64};
+    ASSERT_THROW(shape_infer->infer({std::cref(wrong_rank_dims), std::cref(weights_dims)}, {}), ov::Exception);
+}
+
+TEST(SymbolicShapeInferenceTest, MatMulInnerDimensionsAreChecked) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto weights = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto matmul = std::make_shared<op::v0::MatMul>(data, weights, false, true);
+
+    auto shape_infer = NgraphShapeInferFactory(matmul, EMPTY_PORT_MASK).makeShapeInfer();
+    ASSERT_NE(std::dynamic_pointer_cast<SymbolicShapeInfer>(shape_infer), nullptr);
+
+    const VectorDims data_dims{2, 7, 64};
+    const VectorDims weights_dims{32, 64};
+    auto output_shapes = shape_infer->infer({std::cref(data_dims), std::cref(weights_dims)}, {});
+    ASSERT_EQ(output_shapes[0], VectorDims({2, 7, 32}));
+
+    const VectorDims wrong_weights_dims{32, 65};
+    ASSERT_THROW(shape_infer->infer({std::cref(data_dims), std::cref(wrong_weights_dims)}, {}), ov::Exception);
+}
+
+TEST(SymbolicShapeInferenceTest, TransposeWithConstantOrder) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 3, {1, 100}, -1});
+    auto order = op::v0::Constant::create(element::i64, Shape{4}, {0, 2, 3, 1});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    auto shape_infer = NgraphShapeInferFactory(transpose, 0x2).makeShapeInfer();
+    ASSERT_NE(std::dynamic_pointer_cast<SymbolicShapeInfer>(shape_infer), nullptr);
+    ASSERT_EQ(shape_infer->get_port_mask(), EMPTY_PORT_MASK);
+
+    const VectorDims data_dims{5, 3, 10, 20};
+    const VectorDims order_dims{4};
+    auto output_shapes = shape_infer->infer({std::cref(data_dims), std::cref(order_dims)}, {});
+    ASSERT_EQ(output_shapes[0], VectorDims({5, 10, 20, 3}));
+}
+
+TEST(SymbolicShapeInferenceTest, ConcatAxisIsNotSymbolic) {
+    auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto concat = std::make_shared<op::v0::Concat>(OutputVector{data0, data1}, 1);
+
+    ASSERT_EQ(SymbolicShapeInfer::make(concat), nullptr);
+}
+
+TEST(SymbolicShapeInferenceTest, ReshapeKeepingDimensionIsNotSymbolic) {
+    // the number of elements of the input must be checked, it isn't expressed by the labels
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto pattern = op::v0::Constant::create(element::i64, Shape{2}, {0, 64});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, true);
+
+    ASSERT_EQ(SymbolicShapeInfer::make(reshape), nullptr);
+}
+
+TEST(SymbolicShapeInferenceTest, BroadcastingIsNotSymbolic) {
+    auto data0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto data1 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
+    auto bias = op::v0::Constant::create(element::f32, Shape{64}, {0.f});
+
+    ASSERT_EQ(SymbolicShapeInfer::make(std::make_shared<op::v1::Add>(data0, data1)), nullptr);
+    ASSERT_EQ(SymbolicShapeInfer::make(std::make_shared<op::v1::Add>(data0, bias)), nullptr);
+}
+
+TEST(SymbolicShapeInferenceTest, PoolingWithPadsIsNotSymbolic) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 3, 8, 8});
+    auto pool = std::make_shared<op::v1::MaxPool>(data,
+                                                  Strides{1, 1},
+                                                  Shape{0, 0},
+                                                  Shape{0, 0},
+                                                  Shape{3, 3},
+                                                  op::RoundingType::FLOOR,
+                                                  op::PadType::SAME_UPPER);
+
+    auto shape_infer = NgraphShapeInferFactory(pool, EMPTY_PORT_MASK).makeShapeInfer();
+    ASSERT_EQ(std::dynamic_pointer_cast<SymbolicShapeInfer>(shape_infer), nullptr);
+}
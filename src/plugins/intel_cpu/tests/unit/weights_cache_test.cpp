@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+#include <ie_parallel.hpp>
+#include <cpu_memory.h>
+#include <weights_cache.hpp>
+#include <memory_desc/cpu_blocked_memory_desc.h>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+const dnnl::engine cpuEngine = {dnnl::engine::kind::cpu, 0};
+constexpr size_t memorySize = 1024;
+
+MemoryPtr createMemory(float value) {
+    auto memory = std::make_shared<Memory>(cpuEngine);
+    memory->Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(VectorDims{memorySize})));
+    auto data = static_cast<float*>(memory->GetData());
+    // the parallel loop inside the creation imitates the weights reordering
+    parallel_for(memorySize, [&](size_t i) {
+        data[i] = value;
+    });
+    return memory;
+}
+} // namespace
+
+// Emulates CreatePrimitives stage of several nodes sharing the same weights: the memory is created in parallel
+// loops running inside the outer parallel loop and must not deadlock on the cache lock
+TEST(WeightsSharingTests, ParallelFindOrCreateWithNestedParallelism) {
+    WeightsSharing cache;
+    constexpr size_t nodes = 64;
+    constexpr size_t keys = 4;
+    std::atomic<size_t> created{0};
+    std::vector<MemoryPtr> results(nodes);
+
+    parallel_for(nodes, [&](size_t i) {
+        const auto key = std::to_string(i % keys);
+        auto shared = cache.findOrCreate(key, [&] {
+            created++;
+            return createMemory(static_cast<float>(i % keys));
+        });
+        results[i] = *shared;
+    });
+
+    ASSERT_EQ(keys, created.load());
+    for (size_t i = 0; i < nodes; i++) {
+        ASSERT_EQ(results[i % keys], results[i]);
+        ASSERT_EQ(static_cast<float>(i % keys), static_cast<float*>(results[i]->GetData())[memorySize - 1]);
+    }
+}
+
+TEST(WeightsSharingTests, InvalidMemoryIsFilledBeforeSharing) {
+    WeightsSharing cache;
+    constexpr size_t nodes = 16;
+    std::vector<MemoryPtr> results(nodes);
+
+    parallel_for(nodes, [&](size_t i) {
+        auto shared = cache.findOrCreate("weights", [] {
+            return createMemory(0.f);
+        }, false);
+        if (!shared->isValid()) {
+            MemoryPtr memory = *shared;
+            auto data = static_cast<float*>(memory->GetData());
+            parallel_for(memorySize, [&](size_t j) {
+                data[j] = 1.f;
+            });
+            shared->valid(true);
+        }
+        results[i] = *shared;
+    });
+
+    for (size_t i = 0; i < nodes; i++) {
+        ASSERT_EQ(results[0], results[i]);
+        ASSERT_EQ(1.f, static_cast<float*>(results[i]->GetData())[0]);
+    }
+    ASSERT_TRUE(cache.get("weights")->isValid());
+}
+
+TEST(WeightsSharingTests, FailedCreationIsNotCached) {
+    WeightsSharing cache;
+    ASSERT_THROW(cache.findOrCreate("weights", []() -> MemoryPtr {
+        IE_THROW() << "Creation failed";
+    }), InferenceEngine::Exception);
+    ASSERT_THROW(cache.get("weights"), InferenceEngine::Exception);
+
+    MemoryPtr memory;
+    ASSERT_NO_THROW(memory = *cache.findOrCreate("weights", [] {
+        return createMemory(2.f);
+    }));
+    ASSERT_EQ(memory, static_cast<MemoryPtr>(*cache.get("weights")));
+}
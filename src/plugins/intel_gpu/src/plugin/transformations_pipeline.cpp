@@ -100,6 +100,7 @@
 #include <low_precision/network_helper.hpp>
 #include "transformations/op_conversions/eye_decomposition.hpp"
 #include <low_precision/recurrent_cell.hpp>
+#include <low_precision/softmax.hpp>
 
 #include "intel_gpu/plugin/itt.hpp"
 
@@ -459,6 +460,8 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
         auto lptPassConfig = lptManager.get_pass_config();
         // quantized LSTMSequence / GPUSequence are not supported yet. Avoid extra transformation
         lptPassConfig->disable<ngraph::pass::low_precision::RecurrentCellTransformation>();
+        // Softmax is executed in floating point only
+        lptPassConfig->disable<ngraph::pass::low_precision::SoftmaxTransformation>();
         lptPassConfig->set_callback<ngraph::pass::low_precision::MarkupPrecisions>([](const_node_ptr& node) -> bool {
             if (const auto mulitply = std::dynamic_pointer_cast<const ngraph::opset1::Multiply>(node)) {
                 return !MultiplyToGroupConvolutionTransformation::canBeTransformedToGroupConvolution(mulitply);
@@ -125,6 +125,35 @@ TEST_P(OVInferRequestCallbackTests, ImplDoesNotCopyCallback) {
     OV_ASSERT_NO_THROW(req.wait());
 }
 
+TEST_P(OVInferRequestCallbackTests, canCollectLatencyStatistics) {
+    const size_t NUM_ITER = 5;
+    ASSERT_FALSE(execNet.get_property(ov::enable_latency_statistics));
+    OV_ASSERT_NO_THROW(execNet.set_property({ov::enable_latency_statistics(true)}));
+    ASSERT_TRUE(execNet.get_property(ov::enable_latency_statistics));
+    ov::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(req.set_callback([] (std::exception_ptr exception_ptr) {
+        ASSERT_EQ(nullptr, exception_ptr);
+    }));
+    for (size_t i = 0; i < NUM_ITER; ++i) {
+        OV_ASSERT_NO_THROW(req.start_async());
+        OV_ASSERT_NO_THROW(req.wait());
+    }
+    std::map<std::string, std::map<std::string, double>> statistics;
+    OV_ASSERT_NO_THROW(statistics = execNet.get_property(ov::latency_statistics));
+    for (auto&& stage : {"queue_wait", "execution", "callback", "total"}) {
+        ASSERT_EQ(1, statistics.count(stage)) << stage;
+        ASSERT_EQ(static_cast<double>(NUM_ITER), statistics[stage]["count"]) << stage;
+        ASSERT_LE(statistics[stage]["min"], statistics[stage]["p50"]) << stage;
+        ASSERT_LE(statistics[stage]["p50"], statistics[stage]["p99"]) << stage;
+        ASSERT_LE(statistics[stage]["p99"], statistics[stage]["max"]) << stage;
+    }
+
+    OV_ASSERT_NO_THROW(execNet.set_property({ov::enable_latency_statistics(false)}));
+    ASSERT_FALSE(execNet.get_property(ov::enable_latency_statistics));
+    ASSERT_TRUE(execNet.get_property(ov::latency_statistics).empty());
+}
+
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
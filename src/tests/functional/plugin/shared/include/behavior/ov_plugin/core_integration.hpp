@@ -968,6 +968,36 @@ TEST_P(OVClassNetworkTestP, LoadNetworkActualNoThrow) {
     OV_ASSERT_NO_THROW(ie.compile_model(actualNetwork, target_device));
 }
 
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncActualNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    std::future<ov::CompiledModel> future;
+    OV_ASSERT_NO_THROW(future = ie.compile_model_async(actualNetwork, target_device));
+    ov::CompiledModel model;
+    OV_ASSERT_NO_THROW(model = future.get());
+    OV_ASSERT_NO_THROW(model.create_infer_request());
+}
+
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncManyModelsNoThrow) {
+    ov::Core ie = createCoreWithTemplate();
+    // more compilations than the core keeps pending, the extra calls wait for the queue
+    std::vector<std::future<ov::CompiledModel>> futures(32);
+    for (auto&& future : futures) {
+        OV_ASSERT_NO_THROW(future = ie.compile_model_async(actualNetwork, target_device));
+    }
+    for (auto&& future : futures) {
+        ov::CompiledModel model;
+        OV_ASSERT_NO_THROW(model = future.get());
+        OV_ASSERT_NO_THROW(model.create_infer_request());
+    }
+}
+
+TEST_P(OVClassNetworkTestP, LoadNetworkAsyncWrongDeviceThrowsOnGet) {
+    ov::Core ie = createCoreWithTemplate();
+    std::future<ov::CompiledModel> future;
+    OV_ASSERT_NO_THROW(future = ie.compile_model_async(actualNetwork, "UNREGISTERED_DEVICE"));
+    ASSERT_THROW(future.get(), ov::Exception);
+}
+
 TEST_P(OVClassNetworkTestP, LoadNetworkMultiWithoutSettingDevicePrioritiesThrows) {
     ov::Core ie = createCoreWithTemplate();
     ie.compile_model(actualNetwork, CommonTestUtils::DEVICE_MULTI);
@@ -326,6 +326,19 @@ TEST(IEClassBasicTest, smoke_SetConfigHeteroNoThrow) {
     ASSERT_FALSE(value);
 }
 
+TEST(IEClassBasicTest, smoke_SetConfigHeteroPipelinedExecutionNoThrow) {
+    InferenceEngine::Core  ie = BehaviorTestsUtils::createIECoreWithTemplate();
+    bool value = true;
+
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINED_EXECUTION)).as<bool>());
+    ASSERT_FALSE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(PIPELINED_EXECUTION), InferenceEngine::PluginConfigParams::YES}},
+                                 CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINED_EXECUTION)).as<bool>());
+    ASSERT_TRUE(value);
+}
+
 TEST_P(IEClassSpecificDeviceTestSetConfig, SetConfigSpecificDeviceNoThrow) {
     InferenceEngine::Core ie = BehaviorTestsUtils::createIECoreWithTemplate();
 
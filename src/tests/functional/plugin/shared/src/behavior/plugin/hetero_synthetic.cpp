@@ -11,6 +11,7 @@
 #include "openvino/util/file_util.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include "hetero/hetero_plugin_config.hpp"
 
 namespace HeteroTests {
 
@@ -193,4 +194,44 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedExecutionManyRequestsInFlight) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = InferenceEngine::PluginConfigParams::YES;
+    Run();
+    const auto expectedOutputs = GetOutputs();
+
+    // all the requests are started at once, so the subgraphs of consecutive requests run at the same time
+    constexpr std::size_t requestsNum = 8;
+    std::vector<InferenceEngine::InferRequest> requests;
+    const auto& functionParams = function->get_parameters();
+    for (std::size_t r = 0; r < requestsNum; ++r) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        for (std::size_t i = 0; i < functionParams.size(); ++i) {
+            requests.back().SetBlob(functionParams[i]->get_friendly_name(), inputs[i]);
+        }
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+    }
+    for (auto&& request : requests) {
+        std::size_t i = 0;
+        for (const auto& output : executableNetwork.GetOutputsInfo()) {
+            Compare(expectedOutputs[i++], request.GetBlob(output.first));
+        }
+    }
+}
+
+TEST_P(HeteroSyntheticTest, pipelinedExecutionWithExclusiveAsyncRequestsThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    SetUpAffinity();
+    configuration[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = InferenceEngine::PluginConfigParams::YES;
+    configuration[CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = InferenceEngine::PluginConfigParams::YES;
+    ASSERT_THROW(LoadNetwork(), InferenceEngine::Exception);
+}
+
 }  //  namespace HeteroTests
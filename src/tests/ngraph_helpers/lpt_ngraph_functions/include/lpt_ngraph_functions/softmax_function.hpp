@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <ngraph/ngraph.hpp>
+#include "lpt_ngraph_functions/common/dequantization_operations.hpp"
+
+namespace ngraph {
+namespace builder {
+namespace subgraph {
+
+class SoftmaxFunction {
+public:
+    static std::shared_ptr<ngraph::Function> get(
+        const ngraph::element::Type precisionBeforeDequantization,
+        const ngraph::PartialShape& inputShape,
+        const size_t axis,
+        const ngraph::builder::subgraph::DequantizationOperations& dequantization);
+};
+
+}  // namespace subgraph
+}  // namespace builder
+}  // namespace ngraph
@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lpt_ngraph_functions/softmax_function.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include "lpt_ngraph_functions/common/builders.hpp"
+
+namespace ngraph {
+namespace builder {
+namespace subgraph {
+
+std::shared_ptr<ngraph::Function> SoftmaxFunction::get(
+    const ngraph::element::Type precisionBeforeDequantization,
+    const ngraph::PartialShape& inputShape,
+    const size_t axis,
+    const ngraph::builder::subgraph::DequantizationOperations& dequantization) {
+    const auto input = std::make_shared<ngraph::opset1::Parameter>(precisionBeforeDequantization, inputShape);
+    const auto dequantizationOp = makeDequantization(input, dequantization);
+    const auto softmax = std::make_shared<ngraph::opset1::Softmax>(dequantizationOp, axis);
+    softmax->set_friendly_name("output");
+
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(softmax) };
+    return std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{ input }, "SoftmaxFunction");
+}
+
+}  // namespace subgraph
+}  // namespace builder
+}  // namespace ngraph